@@ -277,6 +277,9 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
   define_option(ARROW_USE_GLOG "Build libraries with glog support for pluggable logging"
                 OFF)
 
+  define_option(ARROW_WITH_RE2 "Build with support for regular expressions using RE2"
+                OFF)
+
   define_option(ARROW_WITH_BROTLI "Build with Brotli compression" OFF)
   define_option(ARROW_WITH_BZ2 "Build with BZ2 compression" OFF)
   define_option(ARROW_WITH_LZ4 "Build with lz4 compression" OFF)
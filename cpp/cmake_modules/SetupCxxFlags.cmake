@@ -292,6 +292,14 @@ endif()
 
 if(ARROW_USE_SIMD)
   add_definitions(-DARROW_USE_SIMD)
+  # Kernels can also be compiled for these instruction sets regardless of
+  # ARROW_SIMD_LEVEL, to be used when the CPU supports them at runtime
+  if(CXX_SUPPORTS_AVX2)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+  endif()
+  if(CXX_SUPPORTS_AVX512)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+  endif()
 endif()
 
 # ----------------------------------------------------------------------
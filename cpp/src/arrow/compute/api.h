@@ -18,20 +18,30 @@
 #ifndef ARROW_COMPUTE_API_H
 #define ARROW_COMPUTE_API_H
 
-#include "arrow/compute/context.h"  // IWYU pragma: export
-#include "arrow/compute/kernel.h"   // IWYU pragma: export
+#include "arrow/compute/chunked_exec.h"  // IWYU pragma: export
+#include "arrow/compute/context.h"       // IWYU pragma: export
+#include "arrow/compute/kernel.h"        // IWYU pragma: export
+#include "arrow/compute/registry.h"      // IWYU pragma: export
 
-#include "arrow/compute/kernels/boolean.h"          // IWYU pragma: export
-#include "arrow/compute/kernels/cast.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
-#include "arrow/compute/kernels/count.h"            // IWYU pragma: export
-#include "arrow/compute/kernels/filter.h"           // IWYU pragma: export
-#include "arrow/compute/kernels/hash.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/nth_to_indices.h"   // IWYU pragma: export
-#include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
-#include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
-#include "arrow/compute/kernels/take.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/approx_count_distinct.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/arithmetic.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/boolean.h"                // IWYU pragma: export
+#include "arrow/compute/kernels/cast.h"                   // IWYU pragma: export
+#include "arrow/compute/kernels/compare.h"                // IWYU pragma: export
+#include "arrow/compute/kernels/count.h"                  // IWYU pragma: export
+#include "arrow/compute/kernels/filter.h"                 // IWYU pragma: export
+#include "arrow/compute/kernels/group_by.h"               // IWYU pragma: export
+#include "arrow/compute/kernels/hash.h"                   // IWYU pragma: export
+#include "arrow/compute/kernels/hash_join.h"              // IWYU pragma: export
+#include "arrow/compute/kernels/isin.h"                   // IWYU pragma: export
+#include "arrow/compute/kernels/mean.h"                   // IWYU pragma: export
+#include "arrow/compute/kernels/moments.h"                // IWYU pragma: export
+#include "arrow/compute/kernels/nth_to_indices.h"         // IWYU pragma: export
+#include "arrow/compute/kernels/quantile.h"               // IWYU pragma: export
+#include "arrow/compute/kernels/sort_to_indices.h"        // IWYU pragma: export
+#include "arrow/compute/kernels/string.h"                 // IWYU pragma: export
+#include "arrow/compute/kernels/sum.h"                    // IWYU pragma: export
+#include "arrow/compute/kernels/take.h"                   // IWYU pragma: export
+#include "arrow/compute/kernels/top_k.h"                  // IWYU pragma: export
 
 #endif  // ARROW_COMPUTE_API_H
@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/chunked_exec.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CpuInfo;
+
+namespace compute {
+
+namespace {
+
+constexpr int64_t kDefaultL2CacheSize = 256 * 1024;
+constexpr int64_t kMinChunkSize = 1024;
+
+// The arrays of an array-like datum
+std::vector<std::shared_ptr<Array>> GetArrays(const Datum& datum) {
+  if (datum.kind() == Datum::ARRAY) {
+    return {datum.make_array()};
+  }
+  return datum.chunked_array()->chunks();
+}
+
+// An estimate of the bits taken by a value of an array-like datum
+int64_t EstimateValueBits(const Datum& datum) {
+  const DataType& type = *datum.type();
+  if (type.id() == Type::NA) {
+    return 0;
+  }
+  // The validity bitmap
+  int64_t bits = 1;
+  if (is_fixed_width(type.id())) {
+    return bits + checked_cast<const FixedWidthType&>(type).bit_width();
+  }
+  if (is_binary_like(type.id()) || is_large_binary_like(type.id())) {
+    int64_t data_size = 0;
+    for (const auto& array : GetArrays(datum)) {
+      const auto& data = *array->data();
+      if (data.buffers[2] != nullptr) {
+        data_size += data.buffers[2]->size();
+      }
+    }
+    const int offset_bits = is_binary_like(type.id()) ? 32 : 64;
+    return bits + offset_bits + 8 * data_size / std::max<int64_t>(datum.length(), 1);
+  }
+  // Nested types, a guess
+  return bits + 64;
+}
+
+// A chunk of rows, within a chunk of each input
+struct Morsel {
+  int64_t offset;
+  int64_t length;
+};
+
+Status CheckInputs(const std::vector<Datum>& inputs, int64_t* length) {
+  *length = -1;
+  for (const Datum& input : inputs) {
+    if (input.is_scalar()) {
+      continue;
+    }
+    if (!input.is_arraylike()) {
+      return Status::Invalid("ExecuteChunked expects arrays, chunked arrays or scalars");
+    }
+    if (*length != -1 && input.length() != *length) {
+      return Status::Invalid("ExecuteChunked expects inputs of the same length");
+    }
+    *length = input.length();
+  }
+  if (*length == -1) {
+    return Status::Invalid("ExecuteChunked expects at least one array-like input");
+  }
+  return Status::OK();
+}
+
+// Cut the rows at the chunk boundaries of the inputs, then into morsels of at
+// most chunk_size rows
+std::vector<Morsel> MakeMorsels(const std::vector<Datum>& inputs, int64_t length,
+                                int64_t chunk_size) {
+  std::vector<int64_t> boundaries = {0, length};
+  for (const Datum& input : inputs) {
+    if (input.kind() != Datum::CHUNKED_ARRAY) {
+      continue;
+    }
+    int64_t offset = 0;
+    for (const auto& chunk : input.chunked_array()->chunks()) {
+      offset += chunk->length();
+      boundaries.push_back(offset);
+    }
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+  std::vector<Morsel> morsels;
+  for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+    for (int64_t offset = boundaries[i]; offset < boundaries[i + 1];
+         offset += chunk_size) {
+      morsels.push_back({offset, std::min(chunk_size, boundaries[i + 1] - offset)});
+    }
+  }
+  if (morsels.empty()) {
+    // Still run the function once, to find the output type
+    morsels.push_back({0, 0});
+  }
+  return morsels;
+}
+
+// Slice an input to a morsel, which is within one of its chunks
+Status SliceInput(const Datum& input, const Morsel& morsel, Datum* out) {
+  if (input.is_scalar()) {
+    *out = input;
+    return Status::OK();
+  }
+  if (input.kind() == Datum::ARRAY) {
+    *out = input.make_array()->Slice(morsel.offset, morsel.length);
+    return Status::OK();
+  }
+  int64_t chunk_offset = 0;
+  for (const auto& chunk : input.chunked_array()->chunks()) {
+    if (morsel.offset < chunk_offset + chunk->length() ||
+        (morsel.length == 0 && morsel.offset == chunk_offset)) {
+      *out = chunk->Slice(morsel.offset - chunk_offset, morsel.length);
+      return Status::OK();
+    }
+    chunk_offset += chunk->length();
+  }
+  // An empty morsel of a chunked array without chunks
+  DCHECK_EQ(morsel.length, 0);
+  std::shared_ptr<Array> empty;
+  RETURN_NOT_OK(MakeArrayOfNull(input.type(), 0, &empty));
+  *out = empty;
+  return Status::OK();
+}
+
+}  // namespace
+
+int64_t DefaultChunkSize(CpuInfo* cpu_info, const std::vector<Datum>& inputs) {
+  int64_t cache_size = cpu_info->CacheSize(CpuInfo::L2_CACHE);
+  if (cache_size <= 0) {
+    cache_size = kDefaultL2CacheSize;
+  }
+  int64_t row_bits = 0;
+  for (const Datum& input : inputs) {
+    if (input.is_arraylike()) {
+      row_bits += EstimateValueBits(input);
+    }
+  }
+  const int64_t chunk_size = cache_size / 2 * 8 / std::max<int64_t>(row_bits, 1);
+  // A multiple of 64 rows, so that bitmaps are sliced on word boundaries
+  return std::max(kMinChunkSize, chunk_size / 64 * 64);
+}
+
+Status ExecuteChunked(FunctionContext* ctx, const std::vector<Datum>& inputs,
+                      const ChunkFunction& function, const ChunkedExecOptions& options,
+                      Datum* out) {
+  int64_t length;
+  RETURN_NOT_OK(CheckInputs(inputs, &length));
+  if (options.chunk_size < 0) {
+    return Status::Invalid("Chunk size must be positive, or 0 for the default");
+  }
+  const int64_t chunk_size = options.chunk_size > 0
+                                 ? options.chunk_size
+                                 : DefaultChunkSize(ctx->cpu_info(), inputs);
+  const std::vector<Morsel> morsels = MakeMorsels(inputs, length, chunk_size);
+
+  std::vector<std::shared_ptr<Array>> outputs(morsels.size());
+  auto run_morsel = [&](FunctionContext* morsel_ctx, size_t i) -> Status {
+    std::vector<Datum> morsel_inputs(inputs.size());
+    for (size_t j = 0; j < inputs.size(); ++j) {
+      RETURN_NOT_OK(SliceInput(inputs[j], morsels[i], &morsel_inputs[j]));
+    }
+    Datum morsel_out;
+    RETURN_NOT_OK(function(morsel_ctx, morsel_inputs, &morsel_out));
+    if (morsel_out.kind() != Datum::ARRAY) {
+      return Status::Invalid("ExecuteChunked expects the function to output an array");
+    }
+    outputs[i] = morsel_out.make_array();
+    return Status::OK();
+  };
+
+  if (options.use_threads && morsels.size() > 1) {
+    // A FunctionContext per task, since its error status is not thread-safe
+    RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(morsels.size()), [&](int i) {
+      FunctionContext morsel_ctx(ctx->memory_pool());
+      return run_morsel(&morsel_ctx, static_cast<size_t>(i));
+    }));
+  } else {
+    for (size_t i = 0; i < morsels.size(); ++i) {
+      RETURN_NOT_OK(run_morsel(ctx, i));
+    }
+  }
+
+  const auto& type = outputs[0]->type();
+  for (const auto& output : outputs) {
+    if (!output->type()->Equals(*type)) {
+      return Status::TypeError("ExecuteChunked expects the function to output arrays ",
+                               "of the same type, got ", *type, " and ",
+                               *output->type());
+    }
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(outputs), type);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
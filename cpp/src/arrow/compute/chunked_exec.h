@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace internal {
+class CpuInfo;
+}  // namespace internal
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Options for ExecuteChunked
+struct ARROW_EXPORT ChunkedExecOptions {
+  /// The number of rows of the chunks, or 0 to derive it from the L2 cache
+  /// size, see DefaultChunkSize
+  int64_t chunk_size = 0;
+
+  /// Whether to run the chunks in parallel on the CPU thread pool
+  bool use_threads = false;
+};
+
+/// \brief A chain of kernels computing an array from the slices of a chunk
+/// of the inputs
+///
+/// Inputs which are scalars are passed as-is.
+using ChunkFunction = std::function<Status(
+    FunctionContext* ctx, const std::vector<Datum>& inputs, Datum* out)>;
+
+/// \brief The number of rows of chunks whose inputs take about half of the
+/// L2 cache, leaving the other half to the intermediate results
+///
+/// The size of a row is estimated from the types of the array-like inputs,
+/// and from the average length of the values of binary inputs.
+ARROW_EXPORT
+int64_t DefaultChunkSize(internal::CpuInfo* cpu_info, const std::vector<Datum>& inputs);
+
+/// \brief Run a chain of kernels on cache-sized chunks of its inputs
+///
+/// A kernel processes a whole array at once, so when kernels are chained on
+/// a large array the intermediate results are evicted from the cache before
+/// the next kernel reads them.  Running the whole chain on chunks which fit
+/// in the cache avoids that.
+///
+/// The inputs are arrays, chunked arrays of any chunk layout, or scalars.
+/// The array-like inputs must have the same length.  A chunk never spans
+/// chunks of the inputs, so that the inputs are only ever sliced.
+///
+/// \code
+/// ChunkFunction filter_positive = [](FunctionContext* ctx,
+///                                    const std::vector<Datum>& inputs, Datum* out) {
+///   Datum mask;
+///   RETURN_NOT_OK(Compare(ctx, inputs[0], inputs[1],
+///                         CompareOptions(CompareOperator::GREATER), &mask));
+///   return Filter(ctx, inputs[0], mask, out);
+/// };
+/// RETURN_NOT_OK(ExecuteChunked(ctx, {values, Datum(zero)}, filter_positive,
+///                              ChunkedExecOptions(), &out));
+/// \endcode
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] inputs the inputs, at least one of which is array-like
+/// \param[in] function the chain of kernels, which must output an array of
+///            the same type for each chunk
+/// \param[in] options the chunk size, and whether to use threads
+/// \param[out] out a chunked array of the outputs of the chunks, in order
+ARROW_EXPORT
+Status ExecuteChunked(FunctionContext* ctx, const std::vector<Datum>& inputs,
+                      const ChunkFunction& function, const ChunkedExecOptions& options,
+                      Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
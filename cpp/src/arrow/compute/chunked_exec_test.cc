@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/chunked_exec.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+// Negate the values greater than a scalar, dropping the others
+Status NegatePositive(FunctionContext* ctx, const std::vector<Datum>& inputs,
+                      Datum* out) {
+  Datum mask, negated;
+  RETURN_NOT_OK(Compare(ctx, inputs[0], inputs[1],
+                        CompareOptions(CompareOperator::GREATER), &mask));
+  RETURN_NOT_OK(Negate(ctx, inputs[0], ArithmeticOptions(), &negated));
+  return Filter(ctx, negated, mask, out);
+}
+
+class TestExecuteChunked : public ComputeFixture, public TestBase {};
+
+TEST_F(TestExecuteChunked, Basics) {
+  auto values = ArrayFromJSON(int32(), "[1, -2, null, 4, 5, -6, 7]");
+  Datum zero(std::make_shared<Int32Scalar>(0));
+  auto expected = ArrayFromJSON(int32(), "[-1, -4, -5, -7]");
+
+  ChunkedExecOptions options;
+  options.chunk_size = 3;
+  Datum out;
+  ASSERT_OK(ExecuteChunked(&ctx_, {values, zero}, NegatePositive, options, &out));
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected)));
+
+  // Chunks do not span the chunks of the inputs
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2, 1), values->Slice(3)});
+  ASSERT_OK(ExecuteChunked(&ctx_, {chunked, zero}, NegatePositive, options, &out));
+  ASSERT_EQ(4, out.chunked_array()->num_chunks());
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected)));
+
+  // An empty input gives an empty chunk, of the output type
+  ASSERT_OK(
+      ExecuteChunked(&ctx_, {values->Slice(0, 0), zero}, NegatePositive, options, &out));
+  ASSERT_EQ(1, out.chunked_array()->num_chunks());
+  ASSERT_EQ(0, out.chunked_array()->length());
+
+  ASSERT_RAISES(Invalid, ExecuteChunked(&ctx_, {zero}, NegatePositive, options, &out));
+  ASSERT_RAISES(Invalid, ExecuteChunked(&ctx_, {values, values->Slice(1)},
+                                        NegatePositive, options, &out));
+  options.chunk_size = -1;
+  ASSERT_RAISES(Invalid,
+                ExecuteChunked(&ctx_, {values, zero}, NegatePositive, options, &out));
+}
+
+TEST_F(TestExecuteChunked, Threads) {
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto values = rand.Int32(100000, -100, 100, 0.1);
+  Datum zero(std::make_shared<Int32Scalar>(0));
+  Datum expected;
+  ASSERT_OK(NegatePositive(&ctx_, {values, zero}, &expected));
+
+  for (bool use_threads : {false, true}) {
+    for (int64_t chunk_size : {0, 1000, 4097}) {
+      ChunkedExecOptions options;
+      options.chunk_size = chunk_size;
+      options.use_threads = use_threads;
+      Datum out;
+      ASSERT_OK(ExecuteChunked(&ctx_, {values, zero}, NegatePositive, options, &out));
+      ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(expected.make_array())));
+    }
+  }
+}
+
+TEST_F(TestExecuteChunked, DefaultChunkSize) {
+  auto cpu_info = ctx_.cpu_info();
+  auto narrow = ArrayFromJSON(int8(), "[1]");
+  auto wide = ArrayFromJSON(int64(), "[1]");
+  const int64_t narrow_size = DefaultChunkSize(cpu_info, {narrow});
+  const int64_t wide_size = DefaultChunkSize(cpu_info, {wide, wide});
+  ASSERT_GT(narrow_size, wide_size);
+  ASSERT_GE(wide_size, 1024);
+  ASSERT_EQ(0, wide_size % 64);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/compute/kernels/add.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/type_traits.h"
 
 namespace arrow {
@@ -117,12 +118,11 @@ Status AddKernel::Make(const std::shared_ptr<DataType>& value_type,
 Status Add(FunctionContext* ctx, const Array& lhs, const Array& rhs,
            std::shared_ptr<Array>* result) {
   Datum result_datum;
-  std::unique_ptr<AddKernel> kernel;
   ARROW_RETURN_IF(
       !lhs.type()->Equals(rhs.type()),
       Status::Invalid("Array types should be equal to use arithmetic kernels"));
-  RETURN_NOT_OK(AddKernel::Make(lhs.type(), &kernel));
-  RETURN_NOT_OK(kernel->Call(ctx, Datum(lhs.data()), Datum(rhs.data()), &result_datum));
+  RETURN_NOT_OK(Add(ctx, Datum(lhs.data()), Datum(rhs.data()), ArithmeticOptions(),
+                    &result_datum));
   *result = result_datum.make_array();
   return Status::OK();
 }
@@ -40,6 +40,9 @@ class FunctionContext;
 /// For example given lhs = [1, null, 3], rhs = [4, 5, 6], the output
 /// will be [5, null, 7]
 ///
+/// Same as the Add of arithmetic.h on arrays, with integer overflow wrapping
+/// around.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] lhs the first array
 /// \param[in] rhs the second array
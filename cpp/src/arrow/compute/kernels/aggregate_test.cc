@@ -16,17 +16,23 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/approx_count_distinct.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/moments.h"
+#include "arrow/compute/kernels/quantile.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
@@ -352,6 +358,222 @@ TYPED_TEST(TestRandomNumericCountKernel, RandomArrayCount) {
   }
 }
 
+///
+/// Approximate count distinct
+///
+
+static int64_t ApproxCountDistinctOf(FunctionContext* ctx, const Datum& value,
+                                     int precision = 14) {
+  Datum out;
+  ARROW_EXPECT_OK(
+      ApproxCountDistinct(ctx, ApproxCountDistinctOptions(precision), value, &out));
+  return checked_pointer_cast<Int64Scalar>(out.scalar())->value;
+}
+
+class TestApproxCountDistinctKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestApproxCountDistinctKernel, Basics) {
+  // Small counts are estimated exactly
+  ASSERT_EQ(0, ApproxCountDistinctOf(&ctx_, ArrayFromJSON(int32(), "[]")));
+  ASSERT_EQ(0, ApproxCountDistinctOf(&ctx_, ArrayFromJSON(int32(), "[null, null]")));
+  ASSERT_EQ(3,
+            ApproxCountDistinctOf(&ctx_, ArrayFromJSON(int32(), "[1, 2, 2, null, 3]")));
+  ASSERT_EQ(2, ApproxCountDistinctOf(&ctx_, ArrayFromJSON(boolean(), "[true, false]")));
+  ASSERT_EQ(2,
+            ApproxCountDistinctOf(&ctx_, ArrayFromJSON(float64(), "[0.0, -0.0, 1.5]")));
+  ASSERT_EQ(2, ApproxCountDistinctOf(&ctx_, ArrayFromJSON(utf8(), R"(["a", "b", "a"])")));
+  ASSERT_EQ(0, ApproxCountDistinctOf(&ctx_, ArrayFromJSON(null(), "[null, null]")));
+  auto chunked = ChunkedArrayFromJSON(int64(), {"[1, 2]", "[]", "[2, 3]"});
+  ASSERT_EQ(3, ApproxCountDistinctOf(&ctx_, chunked));
+
+  Datum out;
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(3),
+                                             ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(19),
+                                             ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(),
+                                    ArrayFromJSON(list(int32()), "[]"), &out));
+}
+
+TEST_F(TestApproxCountDistinctKernel, Estimate) {
+  const int64_t num_distinct = 20000;
+  std::vector<int64_t> values(num_distinct);
+  for (int64_t i = 0; i < num_distinct; ++i) {
+    values[i] = i * 7919 - num_distinct;
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  ASSERT_OK(Concatenate({array, array->Slice(0, num_distinct / 2)},
+                        default_memory_pool(), &array));
+
+  // The relative standard error is 1.04 / sqrt(2^precision)
+  for (int precision : {10, 14, 18}) {
+    const double error = 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    const int64_t estimate = ApproxCountDistinctOf(&ctx_, array, precision);
+    ASSERT_NEAR(static_cast<double>(num_distinct), static_cast<double>(estimate),
+                4 * error * num_distinct)
+        << "precision " << precision;
+
+    // Merging the sketches of chunks is exact
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{array->Slice(0, 1000), array->Slice(1000, 12345),
+                    array->Slice(13345)});
+    ASSERT_EQ(estimate, ApproxCountDistinctOf(&ctx_, chunked, precision));
+  }
+}
+
+///
+/// Variance, standard deviation, skewness and kurtosis
+///
+
+static double DoubleScalarOf(const Datum& out) {
+  auto scalar = checked_pointer_cast<DoubleScalar>(out.scalar());
+  EXPECT_TRUE(scalar->is_valid);
+  return scalar->value;
+}
+
+static bool IsNullScalar(const Datum& out) { return !out.scalar()->is_valid; }
+
+template <typename ArrowType>
+class TestMomentsKernelNumeric : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_SUITE(TestMomentsKernelNumeric, NumericArrowTypes);
+TYPED_TEST(TestMomentsKernelNumeric, Basics) {
+  auto ty = TypeTraits<TypeParam>::type_singleton();
+  auto array = ArrayFromJSON(ty, "[1, null, 2, 3, 4, 100]");
+  Datum out;
+
+  // Deviations from the mean of 22 are -21, -20, -19, -18 and 78
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(), array, &out));
+  ASSERT_DOUBLE_EQ(1522, DoubleScalarOf(out));
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), array, &out));
+  ASSERT_DOUBLE_EQ(1902.5, DoubleScalarOf(out));
+  ASSERT_OK(Stddev(&this->ctx_, VarianceOptions(), array, &out));
+  ASSERT_DOUBLE_EQ(std::sqrt(1522.0), DoubleScalarOf(out));
+  ASSERT_OK(Skew(&this->ctx_, array, &out));
+  ASSERT_DOUBLE_EQ(88920 / std::pow(1522.0, 1.5), DoubleScalarOf(out));
+  ASSERT_OK(Kurtosis(&this->ctx_, array, &out));
+  ASSERT_DOUBLE_EQ(7520966.8 / (1522.0 * 1522.0) - 3, DoubleScalarOf(out));
+
+  auto single = ArrayFromJSON(ty, "[null, 7]");
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(), single, &out));
+  ASSERT_EQ(0, DoubleScalarOf(out));
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), single, &out));
+  ASSERT_TRUE(IsNullScalar(out));
+  ASSERT_OK(Skew(&this->ctx_, single, &out));
+  ASSERT_TRUE(std::isnan(DoubleScalarOf(out)));
+  ASSERT_OK(Kurtosis(&this->ctx_, ArrayFromJSON(ty, "[null]"), &out));
+  ASSERT_TRUE(IsNullScalar(out));
+}
+
+class TestMomentsKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestMomentsKernel, Invalid) {
+  Datum out;
+  ASSERT_RAISES(Invalid, Variance(&ctx_, VarianceOptions(-1),
+                                  ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                Skew(&ctx_, ArrayFromJSON(boolean(), "[true, false]"), &out));
+}
+
+TEST_F(TestMomentsKernel, MergeChunks) {
+  // Values with a large mean and a small variance lose precision unless
+  // deviations are taken from the mean
+  const int64_t length = 10000;
+  std::vector<double> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = 1e9 + static_cast<double>((i * 7919) % 101) / 10;
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<DoubleType, double>(values, &array);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      array->Slice(0, 3), array->Slice(3, 4096), array->Slice(4099), array->Slice(0, 0)});
+
+  // Computed in higher precision
+  const double variance = 8.50164975;
+  const double skew = 1.0185049343266723e-05;
+  const double kurtosis = -1.2002490769593392;
+  for (const Datum& value : {Datum(array), Datum(chunked)}) {
+    Datum out;
+    ASSERT_OK(Variance(&ctx_, VarianceOptions(), value, &out));
+    ASSERT_NEAR(variance, DoubleScalarOf(out), 1e-6);
+    ASSERT_OK(Skew(&ctx_, value, &out));
+    ASSERT_NEAR(skew, DoubleScalarOf(out), 1e-6);
+    ASSERT_OK(Kurtosis(&ctx_, value, &out));
+    ASSERT_NEAR(kurtosis, DoubleScalarOf(out), 1e-6);
+  }
+}
+
+///
+/// Quantile
+///
+
+class TestQuantileKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestQuantileKernel, Exact) {
+  const QuantileOptions options({0, 0.1, 0.5, 0.9, 1});
+  Datum out;
+  ASSERT_OK(Quantile(&ctx_, options, ArrayFromJSON(int32(), "[5, 1, null, 4, 2, 3]"),
+                     &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 1.4, 3, 4.6, 5]"), *out.make_array());
+
+  auto chunked = ChunkedArrayFromJSON(float64(), {"[5, NaN]", "[]", "[1, 4, 2, 3]"});
+  ASSERT_OK(Quantile(&ctx_, options, chunked, &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 1.4, 3, 4.6, 5]"), *out.make_array());
+
+  ASSERT_OK(Quantile(&ctx_, QuantileOptions({0.5, 0.9}),
+                     ArrayFromJSON(uint8(), "[null, null]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null]"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, Quantile(&ctx_, QuantileOptions({1.5}),
+                                  ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented, Quantile(&ctx_, QuantileOptions(),
+                                         ArrayFromJSON(boolean(), "[]"), &out));
+}
+
+TEST_F(TestQuantileKernel, TDigest) {
+  const TDigestOptions options({0, 0.5, 1});
+  Datum out;
+  ASSERT_OK(TDigest(&ctx_, options, ArrayFromJSON(int32(), "[5, 1, null, 4, 2, 3]"),
+                    &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 3, 5]"), *out.make_array());
+
+  ASSERT_OK(TDigest(&ctx_, options, ArrayFromJSON(float32(), "[null, NaN]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null, null]"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, TDigest(&ctx_, TDigestOptions({-0.1}),
+                                 ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(Invalid, TDigest(&ctx_, TDigestOptions({0.5}, /*delta=*/0),
+                                 ArrayFromJSON(int32(), "[]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                TDigest(&ctx_, options, ArrayFromJSON(utf8(), "[]"), &out));
+}
+
+TEST_F(TestQuantileKernel, TDigestEstimate) {
+  const std::vector<double> q = {0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999};
+  auto array = random::RandomArrayGenerator(0x5487655).Float64(100000, 0, 1000, 0.01);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 1000), array->Slice(1000, 45678),
+                  array->Slice(46678)});
+
+  Datum exact;
+  ASSERT_OK(Quantile(&ctx_, QuantileOptions(q), array, &exact));
+  auto exact_values = checked_pointer_cast<DoubleArray>(exact.make_array());
+  for (const Datum& value : {Datum(array), Datum(chunked)}) {
+    Datum estimate;
+    ASSERT_OK(TDigest(&ctx_, TDigestOptions(q), value, &estimate));
+    auto estimates = checked_pointer_cast<DoubleArray>(estimate.make_array());
+    ASSERT_EQ(estimates->length(), static_cast<int64_t>(q.size()));
+    for (size_t i = 0; i < q.size(); ++i) {
+      // Centroids get smaller towards the tails, and so do the errors
+      const double tolerance = 1000 * 0.05 * std::sqrt(q[i] * (1 - q[i]));
+      ASSERT_NEAR(exact_values->Value(i), estimates->Value(i), tolerance)
+          << "quantile " << q[i];
+    }
+  }
+}
+
 ///
 /// Min / Max
 ///
@@ -0,0 +1,250 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approx_count_distinct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr int ApproxCountDistinctOptions::kMinPrecision;
+constexpr int ApproxCountDistinctOptions::kMaxPrecision;
+
+// The HyperLogLog registers, allocated by the first array consumed
+struct HyperLogLogState {
+  std::vector<uint8_t> registers;
+};
+
+// Murmur3's 64 bit finalizer, spreading the bits of a value over its hash
+static inline uint64_t MixHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+template <typename CType>
+static inline enable_if_t<!std::is_floating_point<CType>::value, uint64_t> HashValue(
+    CType value) {
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(value));
+  return MixHash(bits);
+}
+
+template <typename CType>
+static inline enable_if_t<std::is_floating_point<CType>::value, uint64_t> HashValue(
+    CType value) {
+  // Count the zeros once, and the NaNs
+  if (value == 0) {
+    value = 0;
+  } else if (std::isnan(value)) {
+    value = std::numeric_limits<CType>::quiet_NaN();
+  }
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(value));
+  return MixHash(bits);
+}
+
+static inline uint64_t HashValue(util::string_view value) {
+  return MixHash(internal::ComputeStringHash<0>(value.data(),
+                                                static_cast<int64_t>(value.size())));
+}
+
+template <typename ArrowType>
+class ApproxCountDistinctAggregateFunction final
+    : public AggregateFunctionStaticState<HyperLogLogState> {
+ public:
+  explicit ApproxCountDistinctAggregateFunction(int precision)
+      : precision_(precision) {}
+
+  Status Consume(const Array& input, HyperLogLogState* state) const override {
+    auto& registers = state->registers;
+    registers.resize(size_t(1) << precision_, 0);
+    VisitArrayDataInline<ArrowType>(*input.data(), [&](util::optional<ValueType> value) {
+      if (value.has_value()) {
+        const uint64_t hash = HashValue(*value);
+        // The first bits of the hash pick a register, which keeps the largest
+        // number of leading zeros (plus one) of the remaining bits seen
+        const uint64_t index = hash >> (64 - precision_);
+        const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+        const auto rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+        registers[index] = std::max(registers[index], rank);
+      }
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const HyperLogLogState& src, HyperLogLogState* dst) const override {
+    if (src.registers.empty()) {
+      return Status::OK();
+    }
+    if (dst->registers.empty()) {
+      dst->registers = src.registers;
+      return Status::OK();
+    }
+    for (size_t i = 0; i < dst->registers.size(); ++i) {
+      dst->registers[i] = std::max(dst->registers[i], src.registers[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(const HyperLogLogState& src, Datum* output) const override {
+    *output = Datum(std::make_shared<Int64Scalar>(Estimate(src.registers)));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  using ValueType = typename internal::ArrayDataInlineVisitor<ArrowType>::c_type;
+
+  int64_t Estimate(const std::vector<uint8_t>& registers) const {
+    if (registers.empty()) {
+      return 0;
+    }
+    const double m = static_cast<double>(registers.size());
+    double sum = 0;
+    int64_t zeros = 0;
+    for (uint8_t rank : registers) {
+      sum += std::ldexp(1.0, -rank);
+      zeros += rank == 0;
+    }
+
+    double alpha;
+    switch (registers.size()) {
+      case 16:
+        alpha = 0.673;
+        break;
+      case 32:
+        alpha = 0.697;
+        break;
+      case 64:
+        alpha = 0.709;
+        break;
+      default:
+        alpha = 0.7213 / (1 + 1.079 / m);
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+      // Small cardinalities are better estimated by linear counting. With 64 bit
+      // hashes, large ones need no correction for hash collisions.
+      estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+
+  int precision_;
+};
+
+// Counting the non-null values of null arrays needs no sketch
+class NullApproxCountDistinctAggregateFunction final
+    : public AggregateFunctionStaticState<HyperLogLogState> {
+ public:
+  Status Consume(const Array&, HyperLogLogState*) const override { return Status::OK(); }
+
+  Status Merge(const HyperLogLogState&, HyperLogLogState*) const override {
+    return Status::OK();
+  }
+
+  Status Finalize(const HyperLogLogState&, Datum* output) const override {
+    *output = Datum(std::make_shared<Int64Scalar>(0));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+};
+
+struct MakeApproxCountDistinctVisitor {
+  template <typename T>
+  enable_if_t<has_c_type<T>::value || is_base_binary_type<T>::value ||
+                  is_fixed_size_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    out = std::make_shared<ApproxCountDistinctAggregateFunction<T>>(precision);
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    out = std::make_shared<NullApproxCountDistinctAggregateFunction>();
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  int precision;
+  std::shared_ptr<AggregateFunction> out;
+};
+
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* context,
+    const ApproxCountDistinctOptions& options) {
+  if (options.precision < ApproxCountDistinctOptions::kMinPrecision ||
+      options.precision > ApproxCountDistinctOptions::kMaxPrecision) {
+    return nullptr;
+  }
+  MakeApproxCountDistinctVisitor visitor{options.precision, nullptr};
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.out;
+}
+
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("ApproxCountDistinct is expecting an array-like datum.");
+  }
+  if (options.precision < ApproxCountDistinctOptions::kMinPrecision ||
+      options.precision > ApproxCountDistinctOptions::kMaxPrecision) {
+    return Status::Invalid("ApproxCountDistinct precision must be between ",
+                           ApproxCountDistinctOptions::kMinPrecision, " and ",
+                           ApproxCountDistinctOptions::kMaxPrecision, ", got ",
+                           options.precision);
+  }
+
+  auto aggregate =
+      MakeApproxCountDistinctAggregateFunction(*value.type(), context, options);
+  if (!aggregate) {
+    return Status::NotImplemented("ApproxCountDistinct of type ", *value.type());
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+
+  return kernel->Call(context, value, out);
+}
+
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Array& array,
+                           Datum* out) {
+  return ApproxCountDistinct(context, options, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
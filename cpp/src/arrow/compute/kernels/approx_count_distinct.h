@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class ApproxCountDistinctOptions
+///
+/// The precision of the HyperLogLog sketch estimating the number of distinct
+/// values: with 2^precision registers of a byte each, the relative standard
+/// error of the estimate is about 1.04 / sqrt(2^precision).
+struct ARROW_EXPORT ApproxCountDistinctOptions {
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+
+  explicit ApproxCountDistinctOptions(int precision = 14) : precision(precision) {}
+
+  int precision = 14;
+};
+
+/// \brief Return ApproxCountDistinct function aggregate, or null if the type
+/// or the precision isn't supported
+///
+/// The state of the aggregate is a HyperLogLog sketch, so merging the states
+/// of several arrays, e.g. consumed by different threads, estimates the number
+/// of distinct values in all of them.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* context,
+    const ApproxCountDistinctOptions& options);
+
+/// \brief Estimate the number of distinct non-null values in an array.
+///
+/// Values are distinct if their hashes are: floating point zeros and NaNs
+/// count once each. Supports numeric, temporal, boolean, binary, string,
+/// fixed size binary and decimal arrays, and null arrays.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the precision of the estimate
+/// \param[in] value datum to count, expecting Array or ChunkedArray
+/// \param[out] out datum of the estimate as an Int64Scalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out);
+
+/// \brief Estimate the number of distinct non-null values in an array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the precision of the estimate
+/// \param[in] array to count
+/// \param[out] out datum of the estimate as an Int64Scalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* context,
+                           const ApproxCountDistinctOptions& options, const Array& array,
+                           Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
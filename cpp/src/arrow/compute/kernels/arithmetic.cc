@@ -0,0 +1,746 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/compute/registry.h"
+#include "arrow/compute/registry_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <typename T>
+using enable_if_integral_t = typename std::enable_if<std::is_integral<T>::value, T>::type;
+
+template <typename T>
+using enable_if_signed_t =
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                            T>::type;
+
+template <typename T>
+using enable_if_unsigned_t =
+    typename std::enable_if<std::is_unsigned<T>::value, T>::type;
+
+template <typename T>
+using enable_if_floating_t =
+    typename std::enable_if<std::is_floating_point<T>::value, T>::type;
+
+// Unsigned type at least as wide as int, so that wrapping arithmetic on narrow
+// integers isn't promoted to (overflowing) int
+template <typename T>
+using WrapType = typename std::make_unsigned<
+    typename std::common_type<T, unsigned int>::type>::type;
+
+template <typename T>
+T WrappingAdd(T left, T right) {
+  return static_cast<T>(static_cast<WrapType<T>>(left) + static_cast<WrapType<T>>(right));
+}
+
+template <typename T>
+T WrappingSubtract(T left, T right) {
+  return static_cast<T>(static_cast<WrapType<T>>(left) - static_cast<WrapType<T>>(right));
+}
+
+template <typename T>
+T WrappingMultiply(T left, T right) {
+  return static_cast<T>(static_cast<WrapType<T>>(left) * static_cast<WrapType<T>>(right));
+}
+
+template <typename T>
+T WrappingNegate(T value) {
+  return static_cast<T>(WrapType<T>(0) - static_cast<WrapType<T>>(value));
+}
+
+// Returns whether the product overflows, stores it wrapped around otherwise
+template <typename T>
+bool MultiplyWithOverflow(T left, T right, T* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(left, right, out);
+#else
+  *out = WrappingMultiply(left, right);
+  if (std::is_signed<T>::value &&
+      ((left == static_cast<T>(-1) && right == std::numeric_limits<T>::min()) ||
+       (right == static_cast<T>(-1) && left == std::numeric_limits<T>::min()))) {
+    return true;
+  }
+  return right != 0 && *out / right != left;
+#endif
+}
+
+// Whether dividing left by right overflows, i.e. is min() / -1
+template <typename T>
+bool DivideOverflows(T left, T right) {
+  return std::is_signed<T>::value && left == std::numeric_limits<T>::min() &&
+         right == static_cast<T>(-1);
+}
+
+// Arithmetic operations, as
+//
+//   template <typename T> static T Call(T left, T right, bool* error)
+//
+// setting *error for operations which are errors, e.g. which overflow when
+// overflow is checked, and as many arguments for unary operations.  Errors
+// are flagged rather than returned so that the loops over the values remain
+// free of branches, and are described by Error(left, right).
+
+struct Overflows {
+  template <typename... T>
+  static Status Error(T...) {
+    return Status::Invalid("overflow");
+  }
+};
+
+struct AddOp : Overflows {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right, bool*) {
+    return WrappingAdd(left, right);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left + right;
+  }
+};
+
+struct AddCheckedOp : Overflows {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T left, T right, bool* error) {
+    const T result = WrappingAdd(left, right);
+    // Overflow iff both operands have the sign the result lacks
+    *error |= ((left ^ result) & (right ^ result)) < 0;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T left, T right, bool* error) {
+    const T result = WrappingAdd(left, right);
+    *error |= result < left;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left + right;
+  }
+};
+
+struct SubtractOp : Overflows {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right, bool*) {
+    return WrappingSubtract(left, right);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left - right;
+  }
+};
+
+struct SubtractCheckedOp : Overflows {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T left, T right, bool* error) {
+    const T result = WrappingSubtract(left, right);
+    // Overflow iff the operands differ in sign, and the result has the sign
+    // of the subtrahend
+    *error |= ((left ^ right) & (left ^ result)) < 0;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T left, T right, bool* error) {
+    *error |= left < right;
+    return WrappingSubtract(left, right);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left - right;
+  }
+};
+
+struct MultiplyOp : Overflows {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right, bool*) {
+    return WrappingMultiply(left, right);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left * right;
+  }
+};
+
+struct MultiplyCheckedOp : Overflows {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right, bool* error) {
+    T result;
+    *error |= MultiplyWithOverflow(left, right, &result);
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left * right;
+  }
+};
+
+template <bool kCheckOverflow>
+struct DivideOpImpl {
+  // Divisions which are undefined divide by 1 instead, and the result is
+  // then selected, so that there is no branch around the division
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right, bool* error) {
+    const bool by_zero = right == 0;
+    const bool overflows = DivideOverflows(left, right);
+    *error |= by_zero | (kCheckOverflow & overflows);
+    // min() / -1 wraps around to itself, i.e. to min() / 1
+    const T quotient = left / ((by_zero | overflows) ? static_cast<T>(1) : right);
+    return by_zero ? static_cast<T>(0) : quotient;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right, bool*) {
+    return left / right;
+  }
+
+  template <typename T>
+  static Status Error(T, T right) {
+    return right == 0 ? Status::Invalid("divide by zero") : Status::Invalid("overflow");
+  }
+};
+
+using DivideOp = DivideOpImpl<false>;
+using DivideCheckedOp = DivideOpImpl<true>;
+
+template <typename T>
+typename std::enable_if<std::is_signed<T>::value, bool>::type IsNegative(T value) {
+  return value < 0;
+}
+
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, bool>::type IsNegative(T) {
+  return false;
+}
+
+template <bool kCheckOverflow>
+struct PowerOpImpl {
+  using Multiply =
+      typename std::conditional<kCheckOverflow, MultiplyCheckedOp, MultiplyOp>::type;
+
+  // Exponentiation by squaring
+  template <typename T>
+  static enable_if_integral_t<T> Call(T base, T exponent, bool* error) {
+    if (IsNegative(exponent)) {
+      *error = true;
+      return 0;
+    }
+    T result = 1;
+    while (exponent != 0) {
+      if (exponent & 1) {
+        result = Multiply::Call(result, base, error);
+      }
+      exponent >>= 1;
+      if (exponent != 0) {
+        base = Multiply::Call(base, base, error);
+      }
+    }
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T base, T exponent, bool*) {
+    return std::pow(base, exponent);
+  }
+
+  template <typename T>
+  static Status Error(T, T exponent) {
+    if (IsNegative(exponent)) {
+      return Status::Invalid("integers to negative integer powers are not allowed");
+    }
+    return Status::Invalid("overflow");
+  }
+};
+
+using PowerOp = PowerOpImpl<false>;
+using PowerCheckedOp = PowerOpImpl<true>;
+
+struct NegateOp : Overflows {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T value, bool*) {
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T value, bool*) {
+    return -value;
+  }
+};
+
+struct NegateCheckedOp : Overflows {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T value, bool* error) {
+    *error |= value == std::numeric_limits<T>::min();
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T value, bool* error) {
+    *error |= value != 0;
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T value, bool*) {
+    return -value;
+  }
+};
+
+template <bool kCheckOverflow>
+struct AbsoluteValueOpImpl : Overflows {
+  template <typename T>
+  static enable_if_signed_t<T> Call(T value, bool* error) {
+    *error |= kCheckOverflow && value == std::numeric_limits<T>::min();
+    return value < 0 ? WrappingNegate(value) : value;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_t<T> Call(T value, bool*) {
+    return value;
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T value, bool*) {
+    return std::fabs(value);
+  }
+};
+
+using AbsoluteValueOp = AbsoluteValueOpImpl<false>;
+using AbsoluteValueCheckedOp = AbsoluteValueOpImpl<true>;
+
+// Whether an operation never fails, so that its kernels may write their
+// output into one of their inputs
+template <typename Op>
+struct NeverFails : std::false_type {};
+template <>
+struct NeverFails<AddOp> : std::true_type {};
+template <>
+struct NeverFails<SubtractOp> : std::true_type {};
+template <>
+struct NeverFails<MultiplyOp> : std::true_type {};
+template <>
+struct NeverFails<NegateOp> : std::true_type {};
+template <>
+struct NeverFails<AbsoluteValueOp> : std::true_type {};
+
+template <typename T>
+struct ArrayValues {
+  T operator()(int64_t i) const { return values[i]; }
+  const T* values;
+};
+
+template <typename T>
+struct ScalarValue {
+  T operator()(int64_t) const { return value; }
+  T value;
+};
+
+// Whether an output slot is valid, i.e. an error there is an error
+inline bool IsValid(const ArrayData& out, int64_t i) {
+  return out.buffers[0] == nullptr || BitUtil::GetBit(out.buffers[0]->data(), i);
+}
+
+// The loops computing the output values, which only record whether an
+// operation failed.  They are compiled for each SIMD level, so they must be
+// inlined into the functions of the level.
+
+template <typename Op, typename T, typename Left, typename Right>
+inline bool BinaryLoop(Left left, Right right, int64_t length, T* out) {
+  bool error = false;
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = Op::Call(left(i), right(i), &error);
+  }
+  return error;
+}
+
+template <typename Op, typename T>
+inline bool UnaryLoop(const T* values, int64_t length, T* out) {
+  bool error = false;
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = Op::Call(values[i], &error);
+  }
+  return error;
+}
+
+template <SimdLevel kSimdLevel>
+struct Loops;
+
+template <>
+struct Loops<SimdLevel::NONE> {
+  template <typename Op, typename T, typename Left, typename Right>
+  static bool Binary(Left left, Right right, int64_t length, T* out) {
+    return BinaryLoop<Op>(left, right, length, out);
+  }
+
+  template <typename Op, typename T>
+  static bool Unary(const T* values, int64_t length, T* out) {
+    return UnaryLoop<Op>(values, length, out);
+  }
+};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <>
+struct Loops<SimdLevel::AVX2> {
+  template <typename Op, typename T, typename Left, typename Right>
+  ARROW_TARGET_AVX2 static bool Binary(Left left, Right right, int64_t length, T* out) {
+    return BinaryLoop<Op>(left, right, length, out);
+  }
+
+  template <typename Op, typename T>
+  ARROW_TARGET_AVX2 static bool Unary(const T* values, int64_t length, T* out) {
+    return UnaryLoop<Op>(values, length, out);
+  }
+};
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+template <>
+struct Loops<SimdLevel::AVX512> {
+  template <typename Op, typename T, typename Left, typename Right>
+  ARROW_TARGET_AVX512 static bool Binary(Left left, Right right, int64_t length, T* out) {
+    return BinaryLoop<Op>(left, right, length, out);
+  }
+
+  template <typename Op, typename T>
+  ARROW_TARGET_AVX512 static bool Unary(const T* values, int64_t length, T* out) {
+    return UnaryLoop<Op>(values, length, out);
+  }
+};
+#endif
+
+template <typename Op, SimdLevel kSimdLevel, typename T, typename Left, typename Right>
+Status ApplyBinary(Left&& left, Right&& right, ArrayData* out) {
+  T* out_values = out->GetMutableValues<T>(1);
+  const bool error = Loops<kSimdLevel>::template Binary<Op>(left, right, out->length,
+                                                            out_values);
+  if (ARROW_PREDICT_TRUE(!error)) {
+    return Status::OK();
+  }
+  // Operations on the values under nulls may have failed, find one which didn't
+  for (int64_t i = 0; i < out->length; ++i) {
+    bool slot_error = false;
+    Op::Call(left(i), right(i), &slot_error);
+    if (slot_error && IsValid(*out, i)) {
+      return Op::Error(left(i), right(i));
+    }
+  }
+  return Status::OK();
+}
+
+template <typename Op, SimdLevel kSimdLevel, typename T>
+Status ApplyUnary(const T* values, ArrayData* out) {
+  T* out_values = out->GetMutableValues<T>(1);
+  const bool error =
+      Loops<kSimdLevel>::template Unary<Op>(values, out->length, out_values);
+  if (ARROW_PREDICT_TRUE(!error)) {
+    return Status::OK();
+  }
+  for (int64_t i = 0; i < out->length; ++i) {
+    bool slot_error = false;
+    Op::Call(values[i], &slot_error);
+    if (slot_error && IsValid(*out, i)) {
+      return Op::Error(values[i]);
+    }
+  }
+  return Status::OK();
+}
+
+template <typename ArrowType, typename Op, SimdLevel kSimdLevel>
+class ArithmeticBinaryKernel final : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  explicit ArithmeticBinaryKernel(std::shared_ptr<DataType> type)
+      : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out_datum) override {
+    ArrayData* out = out_datum->array().get();
+    if (left.is_array() && right.is_array()) {
+      const ArrayData& left_data = *left.array();
+      const ArrayData& right_data = *right.array();
+      RETURN_NOT_OK(detail::AssignNullIntersection(ctx, left_data, right_data, out));
+      return ApplyBinary<Op, kSimdLevel, T>(ArrayValues<T>{left_data.GetValues<T>(1)},
+                                            ArrayValues<T>{right_data.GetValues<T>(1)},
+                                            out);
+    }
+    if (left.is_array()) {
+      const ArrayData& left_data = *left.array();
+      const auto& right_scalar = checked_cast<const ScalarType&>(*right.scalar());
+      if (!right_scalar.is_valid) {
+        return SetAllNulls(ctx, left_data, out);
+      }
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, out));
+      return ApplyBinary<Op, kSimdLevel, T>(ArrayValues<T>{left_data.GetValues<T>(1)},
+                                            ScalarValue<T>{right_scalar.value}, out);
+    }
+    const auto& left_scalar = checked_cast<const ScalarType&>(*left.scalar());
+    const ArrayData& right_data = *right.array();
+    if (!left_scalar.is_valid) {
+      return SetAllNulls(ctx, right_data, out);
+    }
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, right_data, out));
+    return ApplyBinary<Op, kSimdLevel, T>(ScalarValue<T>{left_scalar.value},
+                                          ArrayValues<T>{right_data.GetValues<T>(1)},
+                                          out);
+  }
+
+ private:
+  Status SetAllNulls(FunctionContext* ctx, const ArrayData& input, ArrayData* out) {
+    T* out_values = out->GetMutableValues<T>(1);
+    std::fill(out_values, out_values + out->length, T(0));
+    return detail::SetAllNulls(ctx, input, out);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+template <typename ArrowType, typename Op, SimdLevel kSimdLevel>
+class ArithmeticUnaryKernel final : public UnaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+
+  explicit ArithmeticUnaryKernel(std::shared_ptr<DataType> type)
+      : type_(std::move(type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out_datum) override {
+    ArrayData* out = out_datum->array().get();
+    const ArrayData& input_data = *input.array();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, input_data, out));
+    return ApplyUnary<Op, kSimdLevel>(input_data.GetValues<T>(1), out);
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <template <typename, typename, SimdLevel> class KernelType, typename Op,
+          SimdLevel kSimdLevel, typename Base>
+Status MakeTypedKernel(const std::shared_ptr<DataType>& type,
+                       std::shared_ptr<Base>* out) {
+  switch (type->id()) {
+#define ARITHMETIC_TYPE_CASE(TYPE_ID, ARROW_TYPE)                 \
+  case Type::TYPE_ID:                                             \
+    out->reset(new KernelType<ARROW_TYPE, Op, kSimdLevel>(type)); \
+    return Status::OK();
+
+    ARITHMETIC_TYPE_CASE(UINT8, UInt8Type)
+    ARITHMETIC_TYPE_CASE(INT8, Int8Type)
+    ARITHMETIC_TYPE_CASE(UINT16, UInt16Type)
+    ARITHMETIC_TYPE_CASE(INT16, Int16Type)
+    ARITHMETIC_TYPE_CASE(UINT32, UInt32Type)
+    ARITHMETIC_TYPE_CASE(INT32, Int32Type)
+    ARITHMETIC_TYPE_CASE(UINT64, UInt64Type)
+    ARITHMETIC_TYPE_CASE(INT64, Int64Type)
+    ARITHMETIC_TYPE_CASE(FLOAT, FloatType)
+    ARITHMETIC_TYPE_CASE(DOUBLE, DoubleType)
+
+#undef ARITHMETIC_TYPE_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Arithmetic operations on ", *type, " arrays");
+}
+
+constexpr Type::type kArithmeticTypes[] = {
+    Type::UINT8,  Type::INT8,   Type::UINT16, Type::INT16, Type::UINT32,
+    Type::INT32,  Type::UINT64, Type::INT64,  Type::FLOAT, Type::DOUBLE};
+
+// Register the kernels of a function for all of the arithmetic types, at a
+// SIMD level
+template <template <typename, typename, SimdLevel> class KernelType, typename Base,
+          typename Op, SimdLevel kSimdLevel>
+Status RegisterLevel(FunctionRegistry* registry, const std::string& name) {
+  const size_t arity = std::is_same<Base, BinaryKernel>::value ? 2 : 1;
+  for (Type::type id : kArithmeticTypes) {
+    RETURN_NOT_OK(registry->AddKernel(
+        name, std::vector<Type::type>(arity, id),
+        [](const std::vector<std::shared_ptr<DataType>>& in_types,
+           std::shared_ptr<OpKernel>* out) {
+          std::shared_ptr<Base> kernel;
+          RETURN_NOT_OK(
+              (MakeTypedKernel<KernelType, Op, kSimdLevel>(in_types[0], &kernel)));
+          *out = detail::MakeAllocatingKernel(std::move(kernel), NeverFails<Op>::value);
+          return Status::OK();
+        },
+        kSimdLevel));
+  }
+  return Status::OK();
+}
+
+// Register the kernels of a function at all of the SIMD levels built
+template <template <typename, typename, SimdLevel> class KernelType, typename Base,
+          typename Op>
+Status RegisterVectorized(FunctionRegistry* registry, const std::string& name) {
+  RETURN_NOT_OK((RegisterLevel<KernelType, Base, Op, SimdLevel::NONE>(registry, name)));
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  RETURN_NOT_OK((RegisterLevel<KernelType, Base, Op, SimdLevel::AVX2>(registry, name)));
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  RETURN_NOT_OK((RegisterLevel<KernelType, Base, Op, SimdLevel::AVX512>(registry, name)));
+#endif
+  return Status::OK();
+}
+
+template <typename Op, typename OpChecked>
+Status RegisterBinary(FunctionRegistry* registry, const std::string& name) {
+  RETURN_NOT_OK(
+      (RegisterVectorized<ArithmeticBinaryKernel, BinaryKernel, Op>(registry, name)));
+  return RegisterVectorized<ArithmeticBinaryKernel, BinaryKernel, OpChecked>(
+      registry, name + "_checked");
+}
+
+template <typename Op, typename OpChecked>
+Status RegisterUnary(FunctionRegistry* registry, const std::string& name) {
+  RETURN_NOT_OK(
+      (RegisterVectorized<ArithmeticUnaryKernel, UnaryKernel, Op>(registry, name)));
+  return RegisterVectorized<ArithmeticUnaryKernel, UnaryKernel, OpChecked>(
+      registry, name + "_checked");
+}
+
+// The registered function implementing an operation with the given options
+std::string FunctionName(const std::string& name, const ArithmeticOptions& options) {
+  return options.check_overflow ? name + "_checked" : name;
+}
+
+Status ExecBinary(FunctionContext* ctx, const std::string& name, const Datum& left,
+                  const Datum& right, const ArithmeticOptions& options, Datum* out) {
+  const bool left_ok = left.is_array() || left.is_scalar();
+  const bool right_ok = right.is_array() || right.is_scalar();
+  if (!left_ok || !right_ok || (left.is_scalar() && right.is_scalar())) {
+    return Status::Invalid("Arithmetic operations expect an array, and an array or a ",
+                           "scalar");
+  }
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Arithmetic operations on data of differing type ",
+                             *left.type(), " vs ", *right.type());
+  }
+  if (left.is_array() && right.is_array() && left.length() != right.length()) {
+    return Status::Invalid("Arithmetic operations expect arrays with the same length");
+  }
+
+  std::shared_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(FunctionRegistry::GetInstance()->GetBinaryKernel(
+      ctx, FunctionName(name, options), left.type(), right.type(), &kernel));
+  return kernel->Call(ctx, left, right, out);
+}
+
+Status ExecUnary(FunctionContext* ctx, const std::string& name, const Datum& value,
+                 const ArithmeticOptions& options, Datum* out) {
+  if (!value.is_array()) {
+    return Status::Invalid("Arithmetic operations expect an array");
+  }
+  std::shared_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(FunctionRegistry::GetInstance()->GetUnaryKernel(
+      ctx, FunctionName(name, options), value.type(), &kernel));
+  return kernel->Call(ctx, value, out);
+}
+
+}  // namespace
+
+namespace detail {
+
+Status RegisterArithmeticKernels(FunctionRegistry* registry) {
+  RETURN_NOT_OK((RegisterBinary<AddOp, AddCheckedOp>(registry, "add")));
+  RETURN_NOT_OK((RegisterBinary<SubtractOp, SubtractCheckedOp>(registry, "subtract")));
+  RETURN_NOT_OK((RegisterBinary<MultiplyOp, MultiplyCheckedOp>(registry, "multiply")));
+  RETURN_NOT_OK((RegisterBinary<DivideOp, DivideCheckedOp>(registry, "divide")));
+  // Exponentiation by squaring does not vectorize
+  RETURN_NOT_OK((RegisterLevel<ArithmeticBinaryKernel, BinaryKernel, PowerOp,
+                               SimdLevel::NONE>(registry, "power")));
+  RETURN_NOT_OK((RegisterLevel<ArithmeticBinaryKernel, BinaryKernel, PowerCheckedOp,
+                               SimdLevel::NONE>(registry, "power_checked")));
+  RETURN_NOT_OK((RegisterUnary<NegateOp, NegateCheckedOp>(registry, "negate")));
+  return RegisterUnary<AbsoluteValueOp, AbsoluteValueCheckedOp>(registry, "abs");
+}
+
+}  // namespace detail
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary(ctx, "add", left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary(ctx, "subtract", left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary(ctx, "multiply", left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary(ctx, "divide", left, right, options, out);
+}
+
+Status Power(FunctionContext* ctx, const Datum& base, const Datum& exponent,
+             const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary(ctx, "power", base, exponent, options, out);
+}
+
+Status Negate(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+              Datum* out) {
+  return ExecUnary(ctx, "negate", value, options, out);
+}
+
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value,
+                     const ArithmeticOptions& options, Datum* out) {
+  return ExecUnary(ctx, "abs", value, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() : check_overflow(false) {}
+  explicit ArithmeticOptions(bool check_overflow) : check_overflow(check_overflow) {}
+
+  /// Whether integer overflow is an error rather than wrapping around.
+  /// Floating point arithmetic follows IEEE 754 either way.
+  bool check_overflow;
+};
+
+/// \brief Add two numeric datums element-wise
+///
+/// Both operands must have the same numeric type, which is the type of the
+/// output.  Either may be a scalar, but not both.  The output is null where
+/// either operand is null.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the first operand
+/// \param[in] right the second operand
+/// \param[in] options whether to check for overflow
+/// \param[out] out the sum of the operands
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out);
+
+/// \brief Subtract a numeric datum from another element-wise
+///
+/// Same as Add.
+///
+/// For example given left = [5, null, 3] and right = 1, the output will be
+/// [4, null, 2]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the minuend
+/// \param[in] right the subtrahend
+/// \param[in] options whether to check for overflow
+/// \param[out] out the difference of the operands
+ARROW_EXPORT
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Multiply two numeric datums element-wise
+///
+/// Same as Add.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the first operand
+/// \param[in] right the second operand
+/// \param[in] options whether to check for overflow
+/// \param[out] out the product of the operands
+ARROW_EXPORT
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Divide a numeric datum by another element-wise
+///
+/// Same as Add.  Integer division truncates towards zero, and integer
+/// division by zero is an error whether overflow is checked or not.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the dividend
+/// \param[in] right the divisor
+/// \param[in] options whether to check for overflow
+/// \param[out] out the quotient of the operands
+ARROW_EXPORT
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out);
+
+/// \brief Raise a numeric datum to the power of another element-wise
+///
+/// Same as Add.  Raising an integer to a negative power is an error.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] base the base
+/// \param[in] exponent the exponent
+/// \param[in] options whether to check for overflow
+/// \param[out] out the power
+ARROW_EXPORT
+Status Power(FunctionContext* ctx, const Datum& base, const Datum& exponent,
+             const ArithmeticOptions& options, Datum* out);
+
+/// \brief Negate a numeric array element-wise
+///
+/// The output has the type of the input, and is null where the input is
+/// null.  Negating a nonzero unsigned integer overflows.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the array to negate
+/// \param[in] options whether to check for overflow
+/// \param[out] out the negated array
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& value, const ArithmeticOptions& options,
+              Datum* out);
+
+/// \brief Compute the absolute value of a numeric array element-wise
+///
+/// Same as Negate.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the input array
+/// \param[in] options whether to check for overflow
+/// \param[out] out the absolute values
+ARROW_EXPORT
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value,
+                     const ArithmeticOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
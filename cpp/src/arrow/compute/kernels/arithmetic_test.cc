@@ -0,0 +1,294 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+using BinaryFunction = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                  const ArithmeticOptions&, Datum*);
+using UnaryFunction = Status (*)(FunctionContext*, const Datum&, const ArithmeticOptions&,
+                                 Datum*);
+
+template <typename ArrowType>
+class TestArithmeticKernel : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<Scalar> ScalarOf(CType value) {
+    return std::make_shared<ScalarType>(value);
+  }
+
+  std::string Max() { return std::to_string(std::numeric_limits<CType>::max()); }
+  std::string Min() { return std::to_string(std::numeric_limits<CType>::min()); }
+
+  void AssertDatums(BinaryFunction fn, const Datum& lhs, const Datum& rhs,
+                    const std::string& expected) {
+    Datum actual;
+    ASSERT_OK(fn(&this->ctx_, lhs, rhs, options_, &actual));
+    auto actual_array = actual.make_array();
+    ASSERT_OK(actual_array->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type(), expected), *actual_array);
+  }
+
+  void AssertBinary(BinaryFunction fn, const std::string& lhs, const std::string& rhs,
+                    const std::string& expected) {
+    AssertDatums(fn, ArrayFromJSON(type(), lhs), ArrayFromJSON(type(), rhs), expected);
+  }
+
+  void AssertBinary(BinaryFunction fn, const std::string& lhs, CType rhs,
+                    const std::string& expected) {
+    AssertDatums(fn, ArrayFromJSON(type(), lhs), ScalarOf(rhs), expected);
+  }
+
+  void AssertBinary(BinaryFunction fn, CType lhs, const std::string& rhs,
+                    const std::string& expected) {
+    AssertDatums(fn, ScalarOf(lhs), ArrayFromJSON(type(), rhs), expected);
+  }
+
+  void AssertUnary(UnaryFunction fn, const std::string& value,
+                   const std::string& expected) {
+    Datum actual;
+    ASSERT_OK(fn(&this->ctx_, ArrayFromJSON(type(), value), options_, &actual));
+    auto actual_array = actual.make_array();
+    ASSERT_OK(actual_array->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type(), expected), *actual_array);
+  }
+
+  void AssertBinaryRaises(BinaryFunction fn, const std::string& lhs,
+                          const std::string& rhs, const std::string& message) {
+    Datum actual;
+    ASSERT_RAISES_WITH_MESSAGE(Invalid, "Invalid: " + message,
+                               fn(&this->ctx_, ArrayFromJSON(type(), lhs),
+                                  ArrayFromJSON(type(), rhs), options_, &actual));
+  }
+
+  void AssertUnaryRaises(UnaryFunction fn, const std::string& value,
+                         const std::string& message) {
+    Datum actual;
+    ASSERT_RAISES_WITH_MESSAGE(
+        Invalid, "Invalid: " + message,
+        fn(&this->ctx_, ArrayFromJSON(type(), value), options_, &actual));
+  }
+
+  // An array of the given values with nulls where the given nulls array has
+  // them, rather than zeros under the nulls
+  std::shared_ptr<Array> WithNulls(const std::string& values, const std::string& nulls) {
+    auto data = ArrayFromJSON(type(), values)->data()->Copy();
+    auto null_data = ArrayFromJSON(type(), nulls)->data();
+    data->buffers[0] = null_data->buffers[0];
+    data->null_count = null_data->null_count.load();
+    return MakeArray(data);
+  }
+
+  ArithmeticOptions options_;
+};
+
+template <typename ArrowType>
+class TestArithmeticKernelForNumeric : public TestArithmeticKernel<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticKernelForNumeric, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticKernelForReal : public TestArithmeticKernel<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticKernelForReal, RealArrowTypes);
+
+using SignedIntegerTypes = ::testing::Types<Int8Type, Int16Type, Int32Type, Int64Type>;
+using UnsignedIntegerTypes =
+    ::testing::Types<UInt8Type, UInt16Type, UInt32Type, UInt64Type>;
+
+template <typename ArrowType>
+class TestArithmeticKernelForSigned : public TestArithmeticKernel<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticKernelForSigned, SignedIntegerTypes);
+
+template <typename ArrowType>
+class TestArithmeticKernelForUnsigned : public TestArithmeticKernel<ArrowType> {};
+TYPED_TEST_SUITE(TestArithmeticKernelForUnsigned, UnsignedIntegerTypes);
+
+TYPED_TEST(TestArithmeticKernelForNumeric, Basics) {
+  for (auto check_overflow : {false, true}) {
+    this->options_.check_overflow = check_overflow;
+
+    this->AssertBinary(Add, "[]", "[]", "[]");
+    this->AssertBinary(Add, "[1, 2, null, 4]", "[4, null, 2, 1]", "[5, null, null, 5]");
+    this->AssertBinary(Subtract, "[5, 4, null]", "[1, 4, 2]", "[4, 0, null]");
+    this->AssertBinary(Multiply, "[2, 3, null]", "[3, 0, 1]", "[6, 0, null]");
+    this->AssertBinary(Divide, "[6, 7, null]", "[3, 7, 0]", "[2, 1, null]");
+    this->AssertBinary(Power, "[2, 3, 1, null]", "[3, 2, 0, 2]", "[8, 9, 1, null]");
+    this->AssertUnary(AbsoluteValue, "[0, 1, null]", "[0, 1, null]");
+  }
+}
+
+TYPED_TEST(TestArithmeticKernelForNumeric, Scalars) {
+  this->AssertBinary(Subtract, "[5, 3, null]", 1, "[4, 2, null]");
+  this->AssertBinary(Subtract, 10, "[5, 3, null]", "[5, 7, null]");
+  this->AssertBinary(Multiply, "[5, 3, null]", 0, "[0, 0, null]");
+  this->AssertBinary(Divide, 12, "[4, 6]", "[3, 2]");
+
+  // A null scalar makes all of the output null
+  Datum actual;
+  ASSERT_OK(Add(&this->ctx_, ArrayFromJSON(this->type(), "[1, 2]"),
+                MakeNullScalar(this->type()), this->options_, &actual));
+  AssertArraysEqual(*ArrayFromJSON(this->type(), "[null, null]"), *actual.make_array());
+}
+
+TYPED_TEST(TestArithmeticKernelForNumeric, Sliced) {
+  auto lhs = ArrayFromJSON(this->type(), "[1, 2, null, 4, 5]")->Slice(1, 3);
+  auto rhs = ArrayFromJSON(this->type(), "[1, null, 1, 1]")->Slice(1);
+  this->AssertDatums(Add, lhs, rhs, "[null, null, 5]");
+}
+
+TYPED_TEST(TestArithmeticKernelForSigned, Basics) {
+  this->AssertBinary(Subtract, "[1, -2, null]", "[3, -5, 1]", "[-2, 3, null]");
+  this->AssertBinary(Multiply, "[-2, -3, 4]", "[3, -3, -1]", "[-6, 9, -4]");
+  this->AssertBinary(Divide, "[-7, 7, -7]", "[2, -2, -2]", "[-3, -3, 3]");
+  this->AssertBinary(Power, "[-2, -2, -1]", "[3, 2, 7]", "[-8, 4, -1]");
+  this->AssertUnary(Negate, "[1, -2, null, 0]", "[-1, 2, null, 0]");
+  this->AssertUnary(AbsoluteValue, "[1, -2, null, 0]", "[1, 2, null, 0]");
+}
+
+TYPED_TEST(TestArithmeticKernelForSigned, Overflow) {
+  const auto max = this->Max(), min = this->Min();
+
+  // Wrap around
+  this->AssertBinary(Add, "[" + max + ", 1]", "[1, 1]", "[" + min + ", 2]");
+  this->AssertBinary(Subtract, "[" + min + "]", "[1]", "[" + max + "]");
+  this->AssertBinary(Multiply, "[" + max + "]", "[2]", "[-2]");
+  this->AssertBinary(Divide, "[" + min + "]", "[-1]", "[" + min + "]");
+  this->AssertUnary(Negate, "[" + min + "]", "[" + min + "]");
+  this->AssertUnary(AbsoluteValue, "[" + min + "]", "[" + min + "]");
+
+  this->options_.check_overflow = true;
+  this->AssertBinaryRaises(Add, "[1, " + max + "]", "[1, 1]", "overflow");
+  this->AssertBinaryRaises(Add, "[" + min + "]", "[-1]", "overflow");
+  this->AssertBinaryRaises(Subtract, "[" + min + "]", "[1]", "overflow");
+  this->AssertBinaryRaises(Subtract, "[0]", "[" + min + "]", "overflow");
+  this->AssertBinaryRaises(Multiply, "[" + max + "]", "[2]", "overflow");
+  this->AssertBinaryRaises(Multiply, "[" + min + "]", "[-1]", "overflow");
+  this->AssertBinaryRaises(Divide, "[" + min + "]", "[-1]", "overflow");
+  const auto bit_width = std::to_string(sizeof(typename TestFixture::CType) * 8);
+  this->AssertBinaryRaises(Power, "[2]", "[" + bit_width + "]", "overflow");
+  this->AssertUnaryRaises(Negate, "[" + min + "]", "overflow");
+  this->AssertUnaryRaises(AbsoluteValue, "[" + min + "]", "overflow");
+
+  // Up to the limits
+  this->AssertBinary(Add, "[" + max + "]", "[0]", "[" + max + "]");
+  this->AssertBinary(Subtract, "[-1]", "[" + max + "]", "[" + min + "]");
+  this->AssertBinary(Multiply, "[" + min + "]", "[1]", "[" + min + "]");
+  this->AssertUnary(Negate, "[" + max + "]", "[-" + max + "]");
+
+  // Overflows under nulls don't count
+  this->AssertDatums(Add, this->WithNulls("[" + max + ", 1]", "[null, 1]"),
+                     ArrayFromJSON(this->type(), "[1, 1]"), "[null, 2]");
+}
+
+TYPED_TEST(TestArithmeticKernelForUnsigned, Overflow) {
+  const auto max = this->Max();
+
+  this->AssertBinary(Add, "[" + max + "]", "[1]", "[0]");
+  this->AssertBinary(Subtract, "[0]", "[1]", "[" + max + "]");
+  this->AssertBinary(Multiply, "[" + max + "]", "[" + max + "]", "[1]");
+  this->AssertUnary(Negate, "[1, 0]", "[" + max + ", 0]");
+  this->AssertUnary(AbsoluteValue, "[" + max + "]", "[" + max + "]");
+
+  this->options_.check_overflow = true;
+  this->AssertBinaryRaises(Add, "[" + max + "]", "[1]", "overflow");
+  this->AssertBinaryRaises(Subtract, "[0]", "[1]", "overflow");
+  this->AssertBinaryRaises(Multiply, "[" + max + "]", "[2]", "overflow");
+  this->AssertUnaryRaises(Negate, "[0, 1]", "overflow");
+  this->AssertUnary(Negate, "[0]", "[0]");
+}
+
+TYPED_TEST(TestArithmeticKernelForSigned, Errors) {
+  for (auto check_overflow : {false, true}) {
+    this->options_.check_overflow = check_overflow;
+    this->AssertBinaryRaises(Divide, "[1, 2]", "[1, 0]", "divide by zero");
+    this->AssertBinaryRaises(Power, "[2]", "[-1]",
+                             "integers to negative integer powers are not allowed");
+
+    // Divisors under nulls don't count
+    this->AssertDatums(Divide, ArrayFromJSON(this->type(), "[1, 4]"),
+                       ArrayFromJSON(this->type(), "[null, 2]"), "[null, 2]");
+  }
+}
+
+TYPED_TEST(TestArithmeticKernelForReal, Basics) {
+  for (auto check_overflow : {false, true}) {
+    this->options_.check_overflow = check_overflow;
+    this->AssertBinary(Add, "[1.5, 0.25, null]", "[1, -0.5, 1]", "[2.5, -0.25, null]");
+    this->AssertBinary(Divide, "[1, -3]", "[4, 2]", "[0.25, -1.5]");
+    this->AssertBinary(Power, "[4, 2, 9]", "[0.5, -1, 0]", "[2, 0.5, 1]");
+    this->AssertUnary(Negate, "[1.5, -0.5, null]", "[-1.5, 0.5, null]");
+    this->AssertUnary(AbsoluteValue, "[1.5, -0.5, null]", "[1.5, 0.5, null]");
+  }
+}
+
+TYPED_TEST(TestArithmeticKernelForReal, NoOverflowErrors) {
+  this->options_.check_overflow = true;
+  using CType = typename TestFixture::CType;
+  const auto max = this->ScalarOf(std::numeric_limits<CType>::max());
+  Datum actual;
+  ASSERT_OK(Multiply(&this->ctx_, ArrayFromJSON(this->type(), "[2]"), max, this->options_,
+                     &actual));
+  ASSERT_TRUE(std::isinf(checked_cast<const typename TypeTraits<TypeParam>::ArrayType&>(
+                             *actual.make_array())
+                             .Value(0)));
+  ASSERT_OK(Divide(&this->ctx_, ArrayFromJSON(this->type(), "[1]"),
+                   ArrayFromJSON(this->type(), "[0]"), this->options_, &actual));
+}
+
+class TestArithmeticKernelErrors : public ComputeFixture, public TestBase {};
+
+TEST_F(TestArithmeticKernelErrors, Signatures) {
+  ArithmeticOptions options;
+  Datum actual;
+  ASSERT_RAISES(TypeError, Add(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                               ArrayFromJSON(int64(), "[1]"), options, &actual));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                             ArrayFromJSON(int32(), "[1, 2]"), options, &actual));
+  std::shared_ptr<Scalar> one = std::make_shared<Int32Scalar>(1);
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, one, one, options, &actual));
+  ASSERT_RAISES(NotImplemented, Add(&this->ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                                    ArrayFromJSON(utf8(), R"(["b"])"), options, &actual));
+  ASSERT_RAISES(NotImplemented, Negate(&this->ctx_, ArrayFromJSON(boolean(), "[true]"),
+                                       options, &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,11 +17,17 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/compute/registry.h"
+#include "arrow/compute/registry_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -145,7 +151,7 @@ RepeatedBufferAsStringView MakeRange(const BaseBinaryScalar& scalar) {
 }
 
 ReadFromBitmap MakeRange(const BooleanArray& array) {
-  return ReadFromBitmap(array.data()->GetValues<uint8_t>(1), array.offset(),
+  return ReadFromBitmap(array.data()->GetValues<uint8_t>(1, 0), array.offset(),
                         array.length());
 }
 
@@ -294,17 +300,33 @@ struct UnpackType {
   CompareOptions options_;
 };
 
+Status MakeCompareKernel(const DataType& type, CompareOptions options,
+                         std::shared_ptr<BinaryKernel>* out) {
+  UnpackType visitor{out, options};
+  return VisitTypeInline(type, &visitor);
+}
+
 // make a compare kernel and invoke it
 inline Status FinishCompare(FunctionContext* context, const Datum& left,
                             const Datum& right, CompareOptions options, Datum* out) {
   std::shared_ptr<BinaryKernel> kernel;
-  UnpackType visitor{&kernel, options};
-  RETURN_NOT_OK(VisitTypeInline(*left.type(), &visitor));
-
-  out->value = ArrayData::Make(kernel->out_type(), left.length());
+  RETURN_NOT_OK(MakeCompareKernel(*left.type(), options, &kernel));
+
+  auto result = ArrayData::Make(kernel->out_type(), left.length(), {nullptr, nullptr});
+  // Write into the previous output, unless it is one of the boolean inputs
+  auto buffer = detail::GetReusableValueBuffer(*out, *result->type, result->length);
+  auto is_input = [&](const Datum& input) {
+    return input.is_array() && input.array()->buffers[1] == buffer;
+  };
+  if (!is_input(left) && !is_input(right)) {
+    result->buffers[1] = std::move(buffer);
+  }
 
-  return detail::PrimitiveAllocatingBinaryKernel(kernel.get())
-      .Call(context, left, right, out);
+  Datum result_datum(std::move(result));
+  RETURN_NOT_OK(detail::PrimitiveAllocatingBinaryKernel(kernel.get())
+                    .Call(context, left, right, &result_datum));
+  *out = std::move(result_datum);
+  return Status::OK();
 }
 
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
@@ -328,5 +350,310 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
   return FinishCompare(context, left, right, options, out);
 }
 
+// ----------------------------------------------------------------------
+// Fused comparisons
+
+namespace {
+
+// Compares values of an array with a scalar a word at a time
+class WordComparator {
+ public:
+  virtual ~WordComparator() = default;
+
+  // Bit i is set if the value at position + i compares true, for i < length
+  virtual uint64_t Compare(int64_t position, int64_t length) const = 0;
+};
+
+template <typename ArrowType, CompareOperator Op, typename Enable = void>
+class TypedWordComparator : public WordComparator {
+ public:
+  using T = typename ArrowType::c_type;
+
+  TypedWordComparator(const ArrayData& values, const Scalar& scalar)
+      : values_(values.GetValues<T>(1)),
+        value_(checked_cast<const typename TypeTraits<ArrowType>::ScalarType&>(scalar)
+                   .value) {}
+
+  uint64_t Compare(int64_t position, int64_t length) const override {
+    // Comparing into bytes first lets the comparisons be vectorized
+    uint8_t matches[64];
+    const T* values = values_ + position;
+    for (int64_t i = 0; i < length; ++i) {
+      matches[i] = Comparator<T, Op>::Compare(values[i], value_);
+    }
+    uint64_t word = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      word |= static_cast<uint64_t>(matches[i]) << i;
+    }
+    return word;
+  }
+
+ private:
+  const T* values_;
+  T value_;
+};
+
+template <typename ArrowType, CompareOperator Op>
+class TypedWordComparator<ArrowType, Op, enable_if_base_binary<ArrowType>>
+    : public WordComparator {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  TypedWordComparator(const ArrayData& values, const Scalar& scalar)
+      : values_(values.Copy()),
+        value_(*checked_cast<const BaseBinaryScalar&>(scalar).value) {}
+
+  uint64_t Compare(int64_t position, int64_t length) const override {
+    uint64_t word = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const bool match =
+          Comparator<string_view, Op>::Compare(values_.GetView(position + i), value_);
+      word |= static_cast<uint64_t>(match) << i;
+    }
+    return word;
+  }
+
+ private:
+  ArrayType values_;
+  string_view value_;
+};
+
+// Booleans are compared a word at a time, false < true
+template <CompareOperator Op>
+class TypedWordComparator<BooleanType, Op> : public WordComparator {
+ public:
+  TypedWordComparator(const ArrayData& values, const Scalar& scalar)
+      : values_(values.GetValues<uint8_t>(1, 0)),
+        offset_(values.offset),
+        value_(checked_cast<const BooleanScalar&>(scalar).value) {}
+
+  uint64_t Compare(int64_t position, int64_t length) const override {
+    const uint64_t values = detail::LoadBitmapWord(values_, offset_ + position, length);
+    const uint64_t all = ~uint64_t(0);
+    switch (Op) {
+      case CompareOperator::EQUAL:
+        return value_ ? values : ~values;
+      case CompareOperator::NOT_EQUAL:
+        return value_ ? ~values : values;
+      case CompareOperator::GREATER:
+        return value_ ? 0 : values;
+      case CompareOperator::GREATER_EQUAL:
+        return value_ ? values : all;
+      case CompareOperator::LESS:
+        return value_ ? ~values : 0;
+      case CompareOperator::LESS_EQUAL:
+        return value_ ? all : ~values;
+    }
+    return 0;
+  }
+
+ private:
+  const uint8_t* values_;
+  int64_t offset_;
+  bool value_;
+};
+
+template <typename ArrowType>
+std::unique_ptr<WordComparator> MakeTypedWordComparator(const ArrayData& values,
+                                                        CompareOperator op,
+                                                        const Scalar& scalar) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::EQUAL>(values, scalar));
+    case CompareOperator::NOT_EQUAL:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::NOT_EQUAL>(values, scalar));
+    case CompareOperator::GREATER:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::GREATER>(values, scalar));
+    case CompareOperator::GREATER_EQUAL:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::GREATER_EQUAL>(values,
+                                                                             scalar));
+    case CompareOperator::LESS:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::LESS>(values, scalar));
+    case CompareOperator::LESS_EQUAL:
+      return std::unique_ptr<WordComparator>(
+          new TypedWordComparator<ArrowType, CompareOperator::LESS_EQUAL>(values,
+                                                                          scalar));
+  }
+  return nullptr;
+}
+
+struct MakeWordComparatorVisitor {
+  Status Visit(const BooleanType&) { return Make<BooleanType>(); }
+
+  template <typename Numeric>
+  enable_if_number<Numeric, Status> Visit(const Numeric&) {
+    return Make<Numeric>();
+  }
+
+  template <typename Temporal>
+  enable_if_temporal<Temporal, Status> Visit(const Temporal&) {
+    return Make<Temporal>();
+  }
+
+  template <typename StringLike>
+  enable_if_base_binary<StringLike, Status> Visit(const StringLike&) {
+    return Make<StringLike>();
+  }
+
+  Status Visit(const DayTimeIntervalType& type) { return NotImplemented(type); }
+  Status Visit(const MonthIntervalType& type) { return NotImplemented(type); }
+  Status Visit(const DurationType& type) { return NotImplemented(type); }
+  Status Visit(const DataType& type) { return NotImplemented(type); }
+
+  Status NotImplemented(const DataType& type) {
+    return Status::NotImplemented("Compare not implemented for type ", type);
+  }
+
+  template <typename ArrowType>
+  Status Make() {
+    *out = MakeTypedWordComparator<ArrowType>(values, op, scalar);
+    return Status::OK();
+  }
+
+  const ArrayData& values;
+  CompareOperator op;
+  const Scalar& scalar;
+  std::unique_ptr<WordComparator>* out;
+};
+
+Status CompareCombined(FunctionContext* ctx,
+                       const std::vector<ScalarComparison>& comparisons, bool is_and,
+                       Datum* out) {
+  if (comparisons.empty()) {
+    return Status::Invalid("Expected at least one comparison");
+  }
+  const int64_t length = comparisons[0].values->length();
+
+  // The comparators, null for comparisons with a null scalar
+  std::vector<std::unique_ptr<WordComparator>> comparators(comparisons.size());
+  bool may_be_null = false;
+  for (size_t i = 0; i < comparisons.size(); ++i) {
+    const ArrayData& values = *comparisons[i].values->data();
+    const Scalar& scalar = *comparisons[i].scalar;
+    if (values.length != length) {
+      return Status::Invalid("Compared arrays must all have the same length");
+    }
+    if (!values.type->Equals(*scalar.type)) {
+      return Status::TypeError("Cannot compare data of differing type ", *values.type,
+                               " vs ", *scalar.type);
+    }
+    may_be_null |= values.GetNullCount() != 0 || !scalar.is_valid;
+    if (scalar.is_valid) {
+      MakeWordComparatorVisitor visitor{values, comparisons[i].op, scalar,
+                                        &comparators[i]};
+      RETURN_NOT_OK(VisitTypeInline(*values.type, &visitor));
+    }
+  }
+
+  std::shared_ptr<Buffer> values_buffer, validity_buffer;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &values_buffer));
+  uint8_t* out_values = values_buffer->mutable_data();
+  uint8_t* out_validity = nullptr;
+  if (may_be_null) {
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validity_buffer));
+    out_validity = validity_buffer->mutable_data();
+  }
+
+  // For each word, the rows whose result is decided, false for a conjunction
+  // and true for a disjunction, and the rows for which a comparison was null
+  for (int64_t position = 0; position < length; position += 64) {
+    const int64_t word_length = std::min<int64_t>(64, length - position);
+    const uint64_t mask =
+        word_length == 64 ? ~uint64_t(0) : (uint64_t(1) << word_length) - 1;
+    uint64_t decided = 0, nulls = 0;
+    for (size_t i = 0; i < comparisons.size() && decided != mask; ++i) {
+      if (comparators[i] == nullptr) {
+        nulls = mask;
+        continue;
+      }
+      const ArrayData& values = *comparisons[i].values->data();
+      uint64_t valid = mask;
+      if (values.buffers[0] != nullptr && values.null_count != 0) {
+        valid = detail::LoadBitmapWord(values.buffers[0]->data(),
+                                       values.offset + position, word_length);
+      }
+      const uint64_t matches = comparators[i]->Compare(position, word_length);
+      decided |= valid & (is_and ? ~matches : matches) & mask;
+      nulls |= ~valid & mask;
+    }
+    const uint64_t out_valid = (decided | ~nulls) & mask;
+    const uint64_t out_word = is_and ? ~decided & out_valid : decided;
+
+    const int64_t num_bytes = BitUtil::BytesForBits(word_length);
+    const uint64_t le_word = BitUtil::ToLittleEndian(out_word);
+    std::memcpy(out_values + position / 8, &le_word, num_bytes);
+    if (out_validity != nullptr) {
+      const uint64_t le_valid = BitUtil::ToLittleEndian(out_valid);
+      std::memcpy(out_validity + position / 8, &le_valid, num_bytes);
+    }
+  }
+
+  int64_t null_count = 0;
+  if (out_validity != nullptr) {
+    null_count = length - internal::CountSetBits(out_validity, 0, length);
+  }
+  out->value = ArrayData::Make(boolean(), length, {validity_buffer, values_buffer},
+                               null_count);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status CompareAnd(FunctionContext* context,
+                  const std::vector<ScalarComparison>& comparisons, Datum* out) {
+  return CompareCombined(context, comparisons, /*is_and=*/true, out);
+}
+
+Status CompareOr(FunctionContext* context,
+                 const std::vector<ScalarComparison>& comparisons, Datum* out) {
+  return CompareCombined(context, comparisons, /*is_and=*/false, out);
+}
+
+namespace detail {
+
+Status RegisterCompareKernels(FunctionRegistry* registry) {
+  static const std::pair<const char*, CompareOperator> kFunctions[] = {
+      {"equal", CompareOperator::EQUAL},
+      {"not_equal", CompareOperator::NOT_EQUAL},
+      {"greater", CompareOperator::GREATER},
+      {"greater_equal", CompareOperator::GREATER_EQUAL},
+      {"less", CompareOperator::LESS},
+      {"less_equal", CompareOperator::LESS_EQUAL}};
+  static const Type::type kTypes[] = {
+      Type::BOOL,   Type::UINT8,     Type::INT8,         Type::UINT16,
+      Type::INT16,  Type::UINT32,    Type::INT32,        Type::UINT64,
+      Type::INT64,  Type::FLOAT,     Type::DOUBLE,       Type::DATE32,
+      Type::DATE64, Type::TIMESTAMP, Type::TIME32,       Type::TIME64,
+      Type::STRING, Type::BINARY,    Type::LARGE_STRING, Type::LARGE_BINARY};
+
+  for (const auto& function : kFunctions) {
+    const CompareOperator op = function.second;
+    for (Type::type id : kTypes) {
+      RETURN_NOT_OK(registry->AddKernel(
+          function.first, {id, id},
+          [op](const std::vector<std::shared_ptr<DataType>>& in_types,
+               std::shared_ptr<OpKernel>* out) {
+            // Parametric types, such as timestamps, must be equal too
+            if (!in_types[0]->Equals(in_types[1])) {
+              return Status::TypeError("Cannot compare data of differing type ",
+                                       *in_types[0], " vs ", *in_types[1]);
+            }
+            std::shared_ptr<BinaryKernel> kernel;
+            RETURN_NOT_OK(MakeCompareKernel(*in_types[0], CompareOptions(op), &kernel));
+            *out = MakeAllocatingKernel(std::move(kernel));
+            return Status::OK();
+          }));
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace detail
+
 }  // namespace compute
 }  // namespace arrow
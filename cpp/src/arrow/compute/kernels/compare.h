@@ -18,13 +18,17 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Array;
 class DataType;
+class Scalar;
 class Status;
 
 namespace compute {
@@ -58,7 +62,8 @@ Status MakeCompareKernel(const DataType& type, CompareOptions options,
 /// \param[in] right datum to compare, must be a Scalar of the same type than
 ///            left Datum.
 /// \param[in] options compare options
-/// \param[out] out resulting datum
+/// \param[out] out resulting datum, whose value buffer is written again if it
+///            holds a previous result of the same length referenced nowhere else
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
 ///
@@ -68,5 +73,50 @@ ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief A comparison of an array with a scalar, see CompareAnd
+struct ARROW_EXPORT ScalarComparison {
+  ScalarComparison(std::shared_ptr<Array> values, CompareOperator op,
+                   std::shared_ptr<Scalar> scalar)
+      : values(std::move(values)), op(op), scalar(std::move(scalar)) {}
+
+  std::shared_ptr<Array> values;
+  CompareOperator op;
+  /// Must have the type of values
+  std::shared_ptr<Scalar> scalar;
+};
+
+/// \brief Evaluate the conjunction of comparisons of arrays with scalars
+///
+/// This is equivalent to combining the results of Compare with KleeneAnd,
+/// but evaluates all of the comparisons 64 rows at a time into a single
+/// output bitmap, skipping the remaining comparisons of the rows once they
+/// are all false.  A comparison of a null value, or with a null scalar, is
+/// null.
+///
+/// For example given a = [1, 6, 7, null], b = [20, 5, null, 1] and the
+/// comparisons a > 5 and b < 10, the output will be [false, true, null, null]
+///
+/// \param[in] context the FunctionContext
+/// \param[in] comparisons the comparisons, of arrays of the same length
+/// \param[out] out boolean array
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status CompareAnd(FunctionContext* context,
+                  const std::vector<ScalarComparison>& comparisons, Datum* out);
+
+/// \brief Evaluate the disjunction of comparisons of arrays with scalars
+///
+/// Same as CompareAnd, with KleeneOr.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] comparisons the comparisons, of arrays of the same length
+/// \param[out] out boolean array
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status CompareOr(FunctionContext* context,
+                 const std::vector<ScalarComparison>& comparisons, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
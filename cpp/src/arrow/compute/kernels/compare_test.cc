@@ -26,6 +26,7 @@
 
 #include "arrow/array.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/type.h"
@@ -552,5 +553,115 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST(TestBooleanCompareKernel, SlicedArrayScalar) {
+  FunctionContext ctx;
+  auto array = ArrayFromJSON(boolean(), "[true, true, false, null, true]")->Slice(1);
+  Datum yes(std::make_shared<BooleanScalar>(true));
+  ValidateCompare<BooleanType>(&ctx, CompareOptions(CompareOperator::EQUAL), array, yes,
+                               ArrayFromJSON(boolean(), "[true, false, null, true]"));
+}
+
+class TestCompareCombined : public ComputeFixture, public TestBase {
+ public:
+  // Check the fused kernels against comparisons combined by Kleene kernels
+  void AssertCombined(const std::vector<ScalarComparison>& comparisons) {
+    for (bool is_and : {true, false}) {
+      Datum expected;
+      for (const auto& comparison : comparisons) {
+        Datum compared;
+        if (comparison.scalar->is_valid) {
+          ASSERT_OK(Compare(&ctx_, comparison.values, comparison.scalar,
+                            CompareOptions(comparison.op), &compared));
+        } else {
+          std::shared_ptr<Array> nulls;
+          ASSERT_OK(
+              MakeArrayOfNull(boolean(), comparison.values->length(), &nulls));
+          compared = nulls;
+        }
+        Datum combined = compared;
+        if (expected.kind() != Datum::NONE && is_and) {
+          ASSERT_OK(KleeneAnd(&ctx_, expected, compared, &combined));
+        } else if (expected.kind() != Datum::NONE) {
+          ASSERT_OK(KleeneOr(&ctx_, expected, compared, &combined));
+        }
+        expected = combined;
+      }
+
+      Datum out;
+      if (is_and) {
+        ASSERT_OK(CompareAnd(&ctx_, comparisons, &out));
+      } else {
+        ASSERT_OK(CompareOr(&ctx_, comparisons, &out));
+      }
+      ASSERT_OK(out.make_array()->ValidateFull());
+      AssertArraysEqual(*expected.make_array(), *out.make_array());
+    }
+  }
+};
+
+TEST_F(TestCompareCombined, Basics) {
+  auto a = ArrayFromJSON(int32(), "[1, 6, 7, null]");
+  auto b = ArrayFromJSON(int32(), "[20, 5, null, 1]");
+  std::shared_ptr<Scalar> five = std::make_shared<Int32Scalar>(5);
+  std::shared_ptr<Scalar> ten = std::make_shared<Int32Scalar>(10);
+
+  Datum out;
+  ASSERT_OK(CompareAnd(&ctx_,
+                       {ScalarComparison(a, CompareOperator::GREATER, five),
+                        ScalarComparison(b, CompareOperator::LESS, ten)},
+                       &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null, null]"),
+                    *out.make_array());
+  ASSERT_OK(CompareOr(&ctx_,
+                      {ScalarComparison(a, CompareOperator::GREATER, five),
+                       ScalarComparison(b, CompareOperator::LESS, ten)},
+                      &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, true, true]"),
+                    *out.make_array());
+
+  auto s = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])");
+  auto t = ArrayFromJSON(boolean(), "[true, false, null, true]");
+  std::shared_ptr<Scalar> b_str = std::make_shared<StringScalar>("b");
+  std::shared_ptr<Scalar> yes = std::make_shared<BooleanScalar>(true);
+  std::shared_ptr<Scalar> null_int = std::make_shared<Int32Scalar>();
+  for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+    AssertCombined({ScalarComparison(s, op, b_str), ScalarComparison(t, op, yes)});
+    AssertCombined({ScalarComparison(a, op, null_int), ScalarComparison(t, op, yes)});
+  }
+
+  ASSERT_RAISES(Invalid, CompareAnd(&ctx_, {}, &out));
+  ASSERT_RAISES(Invalid,
+                CompareAnd(&ctx_,
+                           {ScalarComparison(a, CompareOperator::GREATER, five),
+                            ScalarComparison(a->Slice(1), CompareOperator::LESS, ten)},
+                           &out));
+  ASSERT_RAISES(TypeError,
+                CompareOr(&ctx_, {ScalarComparison(s, CompareOperator::EQUAL, five)},
+                          &out));
+}
+
+TEST_F(TestCompareCombined, Random) {
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  const int64_t length = 1000;
+  for (auto null_probability : {0.0, 0.1, 0.5}) {
+    for (int64_t offset : {0, 3}) {
+      auto ints = rand.Int32(length + offset, 0, 10, null_probability)->Slice(offset);
+      auto doubles =
+          rand.Float64(length + offset, 0, 1, null_probability)->Slice(offset);
+      auto strings =
+          rand.String(length + offset, 0, 2, null_probability)->Slice(offset);
+      auto bools = rand.Boolean(length + offset, 0.5, null_probability)->Slice(offset);
+
+      AssertCombined({ScalarComparison(ints, GREATER, std::make_shared<Int32Scalar>(3)),
+                      ScalarComparison(doubles, LESS_EQUAL,
+                                       std::make_shared<DoubleScalar>(0.8))});
+      AssertCombined(
+          {ScalarComparison(strings, NOT_EQUAL, std::make_shared<StringScalar>("")),
+           ScalarComparison(bools, EQUAL, std::make_shared<BooleanScalar>(false)),
+           ScalarComparison(ints, LESS, std::make_shared<Int32Scalar>(7))});
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,17 +17,27 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include <immintrin.h>
+#endif
+
 #include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -67,15 +77,74 @@ class FilterIndexSequence {
   int64_t index_ = 0, out_length_ = -1;
 };
 
-// TODO(bkietz) this can be optimized
+// Visit a filter 64 positions at a time as visit(first position, selected
+// bits, valid bits) where selected has the bits of the positions at which the
+// filter is true or null
+template <typename Visit>
+static void VisitFilterWords(const BooleanArray& filter, Visit&& visit) {
+  const uint8_t* values = filter.values()->data();
+  const uint8_t* validity = filter.null_count() > 0 ? filter.null_bitmap_data() : NULLPTR;
+  const int64_t offset = filter.offset();
+  for (int64_t position = 0; position < filter.length(); position += 64) {
+    const int64_t length = std::min<int64_t>(64, filter.length() - position);
+    const uint64_t in_range = length == 64 ? ~uint64_t(0) : (uint64_t(1) << length) - 1;
+    uint64_t selected = detail::LoadBitmapWord(values, offset + position, length);
+    uint64_t valid = in_range;
+    if (validity != NULLPTR) {
+      valid = detail::LoadBitmapWord(validity, offset + position, length);
+      selected |= ~valid & in_range;
+    }
+    visit(position, selected, valid);
+  }
+}
+
 static int64_t OutputSize(const BooleanArray& filter) {
   int64_t size = 0;
-  for (auto i = 0; i < filter.length(); ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
+  VisitFilterWords(filter, [&](int64_t, uint64_t selected, uint64_t) {
+    size += BitUtil::PopCount(selected);
+  });
+  return size;
+}
+
+// Write the positions of the set bits of word, offset by base, to out
+static int32_t* AppendSelectedScalar(int32_t base, uint64_t word, int32_t* out) {
+  for (; word != 0; word &= word - 1) {
+    *out++ = base + BitUtil::CountTrailingZeros(word);
+  }
+  return out;
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+// As AppendSelectedScalar, compressing 16 positions at a time
+ARROW_TARGET_AVX512 static int32_t* AppendSelectedAvx512(int32_t base, uint64_t word,
+                                                         int32_t* out) {
+  const __m512i lanes =
+      _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  for (int32_t i = 0; i < 64 && word != 0; i += 16, word >>= 16) {
+    const auto mask = static_cast<__mmask16>(word & 0xFFFF);
+    const __m512i positions = _mm512_add_epi32(_mm512_set1_epi32(base + i), lanes);
+    _mm512_mask_compressstoreu_epi32(out, mask, positions);
+    out += BitUtil::PopCount(mask);
+  }
+  return out;
+}
+#endif
+
+static int32_t* AppendSelected(int32_t base, uint64_t word, bool use_avx512,
+                               int32_t* out) {
+  if (word == ~uint64_t(0)) {
+    // All selected
+    for (int32_t i = 0; i < 64; ++i) {
+      out[i] = base + i;
     }
+    return out + 64;
   }
-  return size;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (use_avx512) {
+    return AppendSelectedAvx512(base, word, out);
+  }
+#endif
+  return AppendSelectedScalar(base, word, out);
 }
 
 static Result<std::shared_ptr<BooleanArray>> GetFilterArray(const Datum& filter) {
@@ -137,6 +206,57 @@ Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
   return Status::OK();
 }
 
+Status FilterToSelectionVector(FunctionContext* ctx, const Array& filter,
+                               std::shared_ptr<Array>* out) {
+  ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter.data())));
+  if (filter.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Selection vectors can address at most ",
+                           std::numeric_limits<int32_t>::max(), " positions, got ",
+                           filter.length());
+  }
+  const int64_t out_length = OutputSize(*filter_array);
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(ctx->Allocate(out_length * sizeof(int32_t), &indices_buf));
+  int32_t* indices = reinterpret_cast<int32_t*>(indices_buf->mutable_data());
+  const bool use_avx512 = ctx->cpu_info()->IsSupported(internal::CpuInfo::AVX512);
+
+  if (filter.null_count() == 0) {
+    int32_t* out_indices = indices;
+    VisitFilterWords(*filter_array, [&](int64_t position, uint64_t selected, uint64_t) {
+      out_indices = AppendSelected(static_cast<int32_t>(position), selected, use_avx512,
+                                   out_indices);
+    });
+    *out = std::make_shared<Int32Array>(out_length, indices_buf);
+    return Status::OK();
+  }
+
+  // Null filter positions are selected as null indices
+  std::shared_ptr<Buffer> validity_buf;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(out_length), &validity_buf));
+  uint8_t* validity = validity_buf->mutable_data();
+  int64_t out_index = 0;
+  VisitFilterWords(*filter_array, [&](int64_t position, uint64_t selected,
+                                      uint64_t valid) {
+    const int64_t num_selected = BitUtil::PopCount(selected);
+    if ((selected & ~valid) == 0) {
+      AppendSelected(static_cast<int32_t>(position), selected, use_avx512,
+                     indices + out_index);
+      BitUtil::SetBitsTo(validity, out_index, num_selected, true);
+      out_index += num_selected;
+      return;
+    }
+    for (; selected != 0; selected &= selected - 1) {
+      const int bit = BitUtil::CountTrailingZeros(selected);
+      indices[out_index] = static_cast<int32_t>(position + bit);
+      BitUtil::SetBitTo(validity, out_index, (valid >> bit) & 1);
+      ++out_index;
+    }
+  });
+  *out = std::make_shared<Int32Array>(out_length, indices_buf, validity_buf,
+                                      filter.null_count());
+  return Status::OK();
+}
+
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
               Datum* out) {
   std::unique_ptr<FilterKernel> kernel;
@@ -146,7 +266,31 @@ Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
 
 Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filter,
               std::shared_ptr<RecordBatch>* out) {
+  return Filter(ctx, batch, filter, FilterOptions(), out);
+}
+
+Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<RecordBatch>* out) {
   ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter.data())));
+  if (batch.num_rows() != filter.length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
+  }
+
+  if (batch.num_columns() > 1 &&
+      filter.length() <= std::numeric_limits<int32_t>::max()) {
+    // Scan the filter once rather than once per column
+    std::shared_ptr<Array> selection;
+    RETURN_NOT_OK(FilterToSelectionVector(ctx, *filter_array, &selection));
+    std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+    RETURN_NOT_OK(detail::RunTasks(
+        ctx, options.use_threads, batch.num_columns(),
+        [&](FunctionContext* ctx, int64_t i) {
+          return Take(ctx, *batch.column(static_cast<int>(i)), *selection,
+                      TakeOptions(), &columns[i]);
+        }));
+    *out = RecordBatch::Make(batch.schema(), selection->length(), columns);
+    return Status::OK();
+  }
 
   std::vector<std::unique_ptr<FilterKernel>> kernels(batch.num_columns());
   for (int i = 0; i < batch.num_columns(); ++i) {
@@ -155,97 +299,159 @@ Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filte
 
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
   auto out_length = OutputSize(*filter_array);
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    RETURN_NOT_OK(kernels[i]->Filter(ctx, *batch.column(i), *filter_array, out_length,
-                                     &columns[i]));
-  }
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, options.use_threads, batch.num_columns(),
+      [&](FunctionContext* ctx, int64_t i) {
+        return kernels[i]->Filter(ctx, *batch.column(static_cast<int>(i)),
+                                  *filter_array, out_length, &columns[i]);
+      }));
 
   *out = RecordBatch::Make(batch.schema(), out_length, columns);
   return Status::OK();
 }
 
+// Filter each chunk of each of columns, in parallel if use_threads.
+// filter_chunk filters a chunk given its offset in its column.
+template <typename FilterChunk>
+static Status FilterChunks(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                           bool use_threads, FilterChunk&& filter_chunk,
+                           std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  struct ChunkTask {
+    size_t column;
+    int chunk;
+    int64_t offset;
+  };
+  std::vector<ChunkTask> tasks;
+  std::vector<std::vector<std::shared_ptr<Array>>> new_chunks(columns.size());
+  for (size_t j = 0; j < columns.size(); ++j) {
+    new_chunks[j].resize(columns[j]->num_chunks());
+    int64_t offset = 0;
+    for (int i = 0; i < columns[j]->num_chunks(); ++i) {
+      tasks.push_back({j, i, offset});
+      offset += columns[j]->chunk(i)->length();
+    }
+  }
+
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, use_threads, static_cast<int64_t>(tasks.size()),
+      [&](FunctionContext* ctx, int64_t k) {
+        const ChunkTask& task = tasks[k];
+        return filter_chunk(ctx, *columns[task.column]->chunk(task.chunk), task.offset,
+                            &new_chunks[task.column][task.chunk]);
+      }));
+
+  out->resize(columns.size());
+  for (size_t j = 0; j < columns.size(); ++j) {
+    (*out)[j] =
+        std::make_shared<ChunkedArray>(std::move(new_chunks[j]), columns[j]->type());
+  }
+  return Status::OK();
+}
+
+// Filter the chunks of columns with a filter array
+static Status FilterChunks(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                           const Array& filter, const FilterOptions& options,
+                           std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  return FilterChunks(
+      ctx, columns, options.use_threads,
+      [&](FunctionContext* ctx, const Array& chunk, int64_t offset,
+          std::shared_ptr<Array>* out_chunk) {
+        return Filter(ctx, chunk, *filter.Slice(offset, chunk.length()), out_chunk);
+      },
+      out);
+}
+
+// Filter the chunks of columns with a filter chunked array
+static Status FilterChunks(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                           const ChunkedArray& filter, const FilterOptions& options,
+                           std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  return FilterChunks(
+      ctx, columns, options.use_threads,
+      [&](FunctionContext* ctx, const Array& chunk, int64_t offset,
+          std::shared_ptr<Array>* out_chunk) {
+        if (chunk.length() == 0) {
+          // Put a zero length array there, which we know our current chunk to be
+          *out_chunk = chunk.Slice(0);
+          return Status::OK();
+        }
+        auto chunk_filter = filter.Slice(offset, chunk.length());
+        std::shared_ptr<Array> filter_array;
+        if (chunk_filter->num_chunks() == 1) {
+          filter_array = chunk_filter->chunk(0);
+        } else {
+          // Concatenate the chunks of the filter so we have an Array
+          RETURN_NOT_OK(
+              Concatenate(chunk_filter->chunks(), ctx->memory_pool(), &filter_array));
+        }
+        return Filter(ctx, chunk, *filter_array, out_chunk);
+      },
+      out);
+}
+
 Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
               std::shared_ptr<ChunkedArray>* out) {
+  return Filter(ctx, values, filter, FilterOptions(), out);
+}
+
+Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<ChunkedArray>* out) {
   if (values.length() != filter.length()) {
     return Status::Invalid("filter and value array must have identical lengths");
   }
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
-  int64_t offset = 0;
-  int64_t len;
-
-  for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    RETURN_NOT_OK(
-        Filter(ctx, *current_chunk, *filter.Slice(offset, len), &new_chunks[i]));
-    offset += len;
-  }
-
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterChunks(ctx, {values.Slice(0)}, filter, options, &columns));
+  *out = std::move(columns[0]);
   return Status::OK();
 }
 
 Status Filter(FunctionContext* ctx, const ChunkedArray& values,
               const ChunkedArray& filter, std::shared_ptr<ChunkedArray>* out) {
+  return Filter(ctx, values, filter, FilterOptions(), out);
+}
+
+Status Filter(FunctionContext* ctx, const ChunkedArray& values,
+              const ChunkedArray& filter, const FilterOptions& options,
+              std::shared_ptr<ChunkedArray>* out) {
   if (values.length() != filter.length()) {
     return Status::Invalid("filter and value array must have identical lengths");
   }
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
-  std::shared_ptr<ChunkedArray> current_chunked_filter;
-  std::shared_ptr<Array> current_filter;
-  int64_t offset = 0;
-  int64_t len;
-
-  for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    if (len > 0) {
-      current_chunked_filter = filter.Slice(offset, len);
-      if (current_chunked_filter->num_chunks() == 1) {
-        current_filter = current_chunked_filter->chunk(0);
-      } else {
-        // Concatenate the chunks of the filter so we have an Array
-        RETURN_NOT_OK(Concatenate(current_chunked_filter->chunks(), default_memory_pool(),
-                                  &current_filter));
-      }
-      RETURN_NOT_OK(Filter(ctx, *current_chunk, *current_filter, &new_chunks[i]));
-      offset += len;
-    } else {
-      // Put a zero length array there, which we know our current chunk to be
-      new_chunks[i] = current_chunk;
-    }
-  }
-
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterChunks(ctx, {values.Slice(0)}, filter, options, &columns));
+  *out = std::move(columns[0]);
   return Status::OK();
 }
 
 Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
               std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+  return Filter(ctx, table, filter, FilterOptions(), out);
+}
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
+Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<Table>* out) {
+  if (table.num_rows() != filter.length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
   }
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterChunks(ctx, table.columns(), filter, options, &columns));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
 
 Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
               std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+  return Filter(ctx, table, filter, FilterOptions(), out);
+}
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
+Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
+              const FilterOptions& options, std::shared_ptr<Table>* out) {
+  if (table.num_rows() != filter.length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
   }
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterChunks(ctx, table.columns(), filter, options, &columns));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
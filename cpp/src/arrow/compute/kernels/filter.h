@@ -32,6 +32,12 @@ namespace compute {
 
 class FunctionContext;
 
+struct ARROW_EXPORT FilterOptions {
+  /// Whether to filter the columns of tables and record batches, and the chunks
+  /// of chunked arrays, in parallel on the CPU thread pool
+  bool use_threads = false;
+};
+
 /// \brief Filter an array with a boolean selection filter
 ///
 /// The output array will be populated with values from the input at positions
@@ -50,6 +56,25 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
               std::shared_ptr<Array>* out);
 
+/// \brief Compute the selection vector of a boolean selection filter
+///
+/// The selection vector holds, in increasing order, the int32 positions at
+/// which the filter is not 0, and a null at each position at which the filter
+/// is null.  Taking values at the selection vector is thus equivalent to
+/// filtering them: the selection can be computed once for a wide record batch
+/// and columns materialized with Take only when used.
+///
+/// For example given filter = [0, 1, 1, 0, null, 1], the output will be
+/// [1, 2, null, 5]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] filter boolean selection filter, at most 2^31 - 1 long
+/// \param[out] out int32 selection vector
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status FilterToSelectionVector(FunctionContext* ctx, const Array& filter,
+                               std::shared_ptr<Array>* out);
+
 /// \brief Filter a chunked array with a boolean selection filter
 ///
 /// The output chunked array will be populated with values from the input at positions
@@ -69,6 +94,14 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
               std::shared_ptr<ChunkedArray>* out);
 
+/// \brief Filter a chunked array with a boolean selection filter, as above
+///
+/// \param[in] options the FilterOptions
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<ChunkedArray>* out);
+
 /// \brief Filter a chunked array with a boolean selection filter
 ///
 /// The output chunked array will be populated with values from the input at positions
@@ -88,6 +121,15 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const ChunkedArray& values,
               const ChunkedArray& filter, std::shared_ptr<ChunkedArray>* out);
 
+/// \brief Filter a chunked array with a boolean selection filter, as above
+///
+/// \param[in] options the FilterOptions
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const ChunkedArray& values,
+              const ChunkedArray& filter, const FilterOptions& options,
+              std::shared_ptr<ChunkedArray>* out);
+
 /// \brief Filter a record batch with a boolean selection filter
 ///
 /// The output record batch's columns will be populated with values from corresponding
@@ -103,6 +145,14 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filter,
               std::shared_ptr<RecordBatch>* out);
 
+/// \brief Filter a record batch with a boolean selection filter, as above
+///
+/// \param[in] options the FilterOptions
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<RecordBatch>* out);
+
 /// \brief Filter a table with a boolean selection filter
 ///
 /// The output table's columns will be populated with values from corresponding
@@ -118,6 +168,14 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
               std::shared_ptr<Table>* out);
 
+/// \brief Filter a table with a boolean selection filter, as above
+///
+/// \param[in] options the FilterOptions
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
+              const FilterOptions& options, std::shared_ptr<Table>* out);
+
 /// \brief Filter a table with a boolean selection filter
 ///
 /// The output record batch's columns will be populated with values from corresponding
@@ -133,6 +191,14 @@ ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
               std::shared_ptr<Table>* out);
 
+/// \brief Filter a table with a boolean selection filter, as above
+///
+/// \param[in] options the FilterOptions
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
+              const FilterOptions& options, std::shared_ptr<Table>* out);
+
 /// \brief Filter an array with a boolean selection filter
 ///
 /// \param[in] ctx the FunctionContext
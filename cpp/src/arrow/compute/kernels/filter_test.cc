@@ -24,6 +24,7 @@
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -479,6 +480,71 @@ TEST_F(TestFilterKernelWithUnion, FilterUnion) {
   }
 }
 
+class TestFilterToSelectionVector : public ComputeFixture, public TestBase {
+ public:
+  void AssertSelection(const std::shared_ptr<Array>& filter,
+                       const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(FilterToSelectionVector(&this->ctx_, *filter, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *actual);
+  }
+
+  // Taking at the selection vector must be the same as filtering
+  void ValidateSelection(const std::shared_ptr<Array>& filter) {
+    auto rand = random::RandomArrayGenerator(kSeed);
+    auto values = rand.Int32(filter->length(), 0, 100, 0.1);
+    std::shared_ptr<Array> selection, taken, filtered;
+    ASSERT_OK(FilterToSelectionVector(&this->ctx_, *filter, &selection));
+    ASSERT_OK(selection->ValidateFull());
+    ASSERT_OK(Take(&this->ctx_, *values, *selection, TakeOptions(), &taken));
+    ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *filter, &filtered));
+    AssertArraysEqual(*filtered, *taken);
+  }
+};
+
+TEST_F(TestFilterToSelectionVector, Basics) {
+  this->AssertSelection(ArrayFromJSON(boolean(), "[]"), "[]");
+  this->AssertSelection(ArrayFromJSON(boolean(), "[0, 0, 0]"), "[]");
+  this->AssertSelection(ArrayFromJSON(boolean(), "[1, 1, 1]"), "[0, 1, 2]");
+  this->AssertSelection(ArrayFromJSON(boolean(), "[0, 1, 1, 0, null, 1]"),
+                        "[1, 2, null, 5]");
+  this->AssertSelection(ArrayFromJSON(boolean(), "[0, 1, 1, 0, null, 1]")->Slice(2),
+                        "[0, null, 3]");
+}
+
+TEST_F(TestFilterToSelectionVector, Words) {
+  // Runs of all true and all false words, straddling word boundaries when sliced
+  BooleanBuilder builder;
+  for (int64_t i = 0; i < 1000; ++i) {
+    ASSERT_OK(builder.Append((i / 200) % 2 == 0 || i % 7 == 0));
+  }
+  std::shared_ptr<Array> filter;
+  ASSERT_OK(builder.Finish(&filter));
+  for (int64_t offset : {0, 1, 13, 64, 199}) {
+    this->ValidateSelection(filter->Slice(offset));
+  }
+}
+
+TEST_F(TestFilterToSelectionVector, Random) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  for (int64_t length : {1, 63, 64, 65, 1000}) {
+    for (auto null_probability : {0.0, 0.01, 0.25, 1.0}) {
+      for (auto filter_probability : {0.0, 0.1, 0.5, 1.0}) {
+        auto filter = rand.Boolean(length, filter_probability, null_probability);
+        this->ValidateSelection(filter);
+        this->ValidateSelection(filter->Slice(length / 3));
+      }
+    }
+  }
+}
+
+TEST_F(TestFilterToSelectionVector, Errors) {
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(TypeError, FilterToSelectionVector(
+                               &this->ctx_, *ArrayFromJSON(int32(), "[0, 1]"), &actual));
+}
+
 class TestFilterKernelWithRecordBatch : public TestFilterKernel<RecordBatch> {
  public:
   void AssertFilter(const std::shared_ptr<Schema>& schm, const std::string& batch_json,
@@ -631,5 +697,41 @@ TEST_F(TestFilterKernelWithTable, FilterTable) {
   this->AssertChunkedFilter(schm, table_json, {"[1]", "[1, 1, 1]"}, table_json);
 }
 
+TEST_F(TestFilterKernelWithTable, FilterTableThreaded) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1000;
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto a = rand.Int32(length, -100, 100, 0.1);
+  auto b = rand.String(length, 0, 10, 0.1);
+  auto table = Table::Make(
+      schm, {std::make_shared<ChunkedArray>(ArrayVector{a->Slice(0, 300), a->Slice(300)}),
+             std::make_shared<ChunkedArray>(
+                 ArrayVector{b->Slice(0, 10), b->Slice(10, 600), b->Slice(610)})});
+  auto filter = rand.Boolean(length, 0.5, 0.1);
+  ChunkedArray chunked_filter({filter->Slice(0, 500), filter->Slice(500)});
+
+  FilterOptions options;
+  options.use_threads = true;
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *table, *filter, &expected));
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *table, *filter, options, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+  ASSERT_OK(
+      arrow::compute::Filter(&this->ctx_, *table, chunked_filter, options, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+
+  auto batch = RecordBatch::Make(schm, length, {a, b});
+  std::shared_ptr<RecordBatch> expected_batch, actual_batch;
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *batch, *filter, &expected_batch));
+  ASSERT_OK(
+      arrow::compute::Filter(&this->ctx_, *batch, *filter, options, &actual_batch));
+  ASSERT_BATCHES_EQUAL(*expected_batch, *actual_batch);
+
+  ASSERT_RAISES(Invalid, arrow::compute::Filter(&this->ctx_, *table, *filter->Slice(1),
+                                                options, &actual));
+}
+
 }  // namespace compute
 }  // namespace arrow
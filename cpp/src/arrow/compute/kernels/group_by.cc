@@ -0,0 +1,582 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::TaskGroup;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouped aggregation states
+//
+// Each aggregator holds the states of all groups in flat vectors indexed by
+// group id, so that a batch is consumed in a single loop over its values.
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  // Grow the states to num_groups groups, new groups being empty
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Update the states from values, values[i] belonging to group group_ids[i]
+  virtual void Consume(const ArrayData& values, const int32_t* group_ids) = 0;
+
+  // Merge the states of other, which must be of the same concrete type, the
+  // state of group i of other being merged into group group_id_mapping[i]
+  virtual void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) = 0;
+
+  // Produce one output value per group
+  virtual Status Finalize(MemoryPool* pool, std::shared_ptr<ArrayData>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Invoke func(i) for the index i of each non-null value of data
+template <typename Function>
+void VisitValidIndices(const ArrayData& data, Function&& func) {
+  if (data.GetNullCount() == 0) {
+    for (int64_t i = 0; i < data.length; i++) {
+      func(i);
+    }
+  } else {
+    internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; i++) {
+      if (reader.IsSet()) {
+        func(i);
+      }
+      reader.Next();
+    }
+  }
+}
+
+// Build a primitive array of length values, value(i) giving the i-th value and
+// is_valid(i) its validity
+template <typename CType, typename ValueFunction, typename ValidFunction>
+Status MakePrimitiveOutput(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                           int64_t length, ValueFunction&& value,
+                           ValidFunction&& is_valid, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * sizeof(CType), &data));
+  auto raw_data = reinterpret_cast<CType*>(data->mutable_data());
+
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; i++) {
+    raw_data[i] = value(i);
+    null_count += !is_valid(i);
+  }
+
+  std::shared_ptr<Buffer> null_bitmap;
+  if (null_count > 0) {
+    RETURN_NOT_OK(AllocateBitmap(pool, length, &null_bitmap));
+    auto bitmap = null_bitmap->mutable_data();
+    for (int64_t i = 0; i < length; i++) {
+      BitUtil::SetBitTo(bitmap, i, is_valid(i));
+    }
+  }
+
+  *out = ArrayData::Make(type, length, {null_bitmap, data}, null_count);
+  return Status::OK();
+}
+
+class GroupedCount final : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    int64_t* counts = counts_.data();
+    VisitValidIndices(values, [&](int64_t i) { ++counts[group_ids[i]]; });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCount&>(other).counts_;
+    for (size_t i = 0; i < other_counts.size(); i++) {
+      counts_[group_id_mapping[i]] += other_counts[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<ArrayData>* out) override {
+    return MakePrimitiveOutput<int64_t>(
+        pool, out_type(), static_cast<int64_t>(counts_.size()),
+        [&](int64_t i) { return counts_[i]; }, [](int64_t i) { return true; }, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// Computes either the sum or the mean of each group
+template <typename ArrowType>
+class GroupedSum final : public GroupedAggregator {
+ public:
+  using CType = typename ArrowType::c_type;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  explicit GroupedSum(bool mean) : mean_(mean) {}
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    const CType* raw_values = values.GetValues<CType>(1);
+    SumCType* sums = sums_.data();
+    int64_t* counts = counts_.data();
+    VisitValidIndices(values, [&](int64_t i) {
+      sums[group_ids[i]] += raw_values[i];
+      ++counts[group_ids[i]];
+    });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_sum = checked_cast<const GroupedSum&>(other);
+    for (size_t i = 0; i < other_sum.sums_.size(); i++) {
+      sums_[group_id_mapping[i]] += other_sum.sums_[i];
+      counts_[group_id_mapping[i]] += other_sum.counts_[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<ArrayData>* out) override {
+    const auto length = static_cast<int64_t>(sums_.size());
+    auto is_valid = [&](int64_t i) { return counts_[i] > 0; };
+    if (mean_) {
+      return MakePrimitiveOutput<double>(
+          pool, out_type(), length,
+          [&](int64_t i) {
+            return counts_[i] > 0 ? static_cast<double>(sums_[i]) / counts_[i] : 0;
+          },
+          is_valid, out);
+    }
+    return MakePrimitiveOutput<SumCType>(
+        pool, out_type(), length, [&](int64_t i) { return sums_[i]; }, is_valid, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return mean_ ? float64() : TypeTraits<SumType>::type_singleton();
+  }
+
+ private:
+  bool mean_;
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename CType>
+enable_if_t<std::is_integral<CType>::value, CType> MinOf(CType left, CType right) {
+  return std::min(left, right);
+}
+
+template <typename CType>
+enable_if_t<std::is_floating_point<CType>::value, CType> MinOf(CType left, CType right) {
+  return std::fmin(left, right);
+}
+
+template <typename CType>
+enable_if_t<std::is_integral<CType>::value, CType> MaxOf(CType left, CType right) {
+  return std::max(left, right);
+}
+
+template <typename CType>
+enable_if_t<std::is_floating_point<CType>::value, CType> MaxOf(CType left, CType right) {
+  return std::fmax(left, right);
+}
+
+template <typename ArrowType, bool kIsMin>
+class GroupedMinMax final : public GroupedAggregator {
+ public:
+  using CType = typename ArrowType::c_type;
+
+  explicit GroupedMinMax(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  void Resize(int64_t num_groups) override {
+    using limits = std::numeric_limits<CType>;
+    const CType identity =
+        kIsMin ? (limits::has_infinity ? limits::infinity() : limits::max())
+               : (limits::has_infinity ? -limits::infinity() : limits::lowest());
+    values_.resize(num_groups, identity);
+    has_values_.resize(num_groups, false);
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    const CType* raw_values = values.GetValues<CType>(1);
+    CType* states = values_.data();
+    VisitValidIndices(values, [&](int64_t i) {
+      const int32_t group = group_ids[i];
+      states[group] = kIsMin ? MinOf(states[group], raw_values[i])
+                             : MaxOf(states[group], raw_values[i]);
+      has_values_[group] = true;
+    });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_min_max = checked_cast<const GroupedMinMax&>(other);
+    for (size_t i = 0; i < other_min_max.values_.size(); i++) {
+      if (!other_min_max.has_values_[i]) continue;
+      const int32_t group = group_id_mapping[i];
+      values_[group] = kIsMin ? MinOf(values_[group], other_min_max.values_[i])
+                              : MaxOf(values_[group], other_min_max.values_[i]);
+      has_values_[group] = true;
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<ArrayData>* out) override {
+    return MakePrimitiveOutput<CType>(
+        pool, type_, static_cast<int64_t>(values_.size()),
+        [&](int64_t i) { return values_[i]; }, [&](int64_t i) { return has_values_[i]; },
+        out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  std::vector<CType> values_;
+  std::vector<bool> has_values_;
+};
+
+template <typename ArrowType>
+std::unique_ptr<GroupedAggregator> MakeNumericAggregator(
+    GroupByAggregate::Kind kind, const std::shared_ptr<DataType>& type) {
+  switch (kind) {
+    case GroupByAggregate::SUM:
+      return std::unique_ptr<GroupedAggregator>(new GroupedSum<ArrowType>(false));
+    case GroupByAggregate::MEAN:
+      return std::unique_ptr<GroupedAggregator>(new GroupedSum<ArrowType>(true));
+    case GroupByAggregate::MIN:
+      return std::unique_ptr<GroupedAggregator>(
+          new GroupedMinMax<ArrowType, true>(type));
+    case GroupByAggregate::MAX:
+      return std::unique_ptr<GroupedAggregator>(
+          new GroupedMinMax<ArrowType, false>(type));
+    default:
+      return nullptr;
+  }
+}
+
+const char* AggregateKindName(GroupByAggregate::Kind kind) {
+  switch (kind) {
+    case GroupByAggregate::SUM:
+      return "sum";
+    case GroupByAggregate::COUNT:
+      return "count";
+    case GroupByAggregate::MIN:
+      return "min";
+    case GroupByAggregate::MAX:
+      return "max";
+    case GroupByAggregate::MEAN:
+      return "mean";
+  }
+  return "unknown";
+}
+
+Status MakeGroupedAggregator(const GroupByAggregate& aggregate,
+                             const std::shared_ptr<DataType>& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  if (aggregate.kind == GroupByAggregate::COUNT) {
+    out->reset(new GroupedCount);
+    return Status::OK();
+  }
+
+  switch (type->id()) {
+#define AGGREGATOR_CASE(T)                                 \
+  case T::type_id:                                         \
+    *out = MakeNumericAggregator<T>(aggregate.kind, type); \
+    break;
+
+    AGGREGATOR_CASE(UInt8Type);
+    AGGREGATOR_CASE(Int8Type);
+    AGGREGATOR_CASE(UInt16Type);
+    AGGREGATOR_CASE(Int16Type);
+    AGGREGATOR_CASE(UInt32Type);
+    AGGREGATOR_CASE(Int32Type);
+    AGGREGATOR_CASE(UInt64Type);
+    AGGREGATOR_CASE(Int64Type);
+    AGGREGATOR_CASE(FloatType);
+    AGGREGATOR_CASE(DoubleType);
+    default:
+      break;
+
+#undef AGGREGATOR_CASE
+  }
+
+  if (*out == nullptr) {
+    return Status::NotImplemented("No grouped ", AggregateKindName(aggregate.kind),
+                                  " for type ", *type);
+  }
+  return Status::OK();
+}
+
+Status FindColumn(const Schema& schema, const std::string& name, int* out) {
+  *out = schema.GetFieldIndex(name);
+  if (*out < 0) {
+    return Status::Invalid("No unique column named '", name, "' in schema ", schema);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// HashGroupBy implementation
+
+class HashGroupByImpl : public HashGroupBy {
+ public:
+  HashGroupByImpl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema)
+      : ctx_(ctx), schema_(schema) {}
+
+  Status Init(const std::vector<std::string>& keys,
+              const std::vector<GroupByAggregate>& aggregates) {
+    std::vector<std::shared_ptr<Field>> out_fields;
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (const auto& key : keys) {
+      int index;
+      RETURN_NOT_OK(FindColumn(*schema_, key, &index));
+      key_indices_.push_back(index);
+      key_types.push_back(schema_->field(index)->type());
+      out_fields.push_back(schema_->field(index));
+    }
+    RETURN_NOT_OK(detail::Grouper::Make(ctx_, key_types, &grouper_));
+
+    for (const auto& aggregate : aggregates) {
+      int index;
+      RETURN_NOT_OK(FindColumn(*schema_, aggregate.target, &index));
+
+      std::unique_ptr<GroupedAggregator> aggregator;
+      RETURN_NOT_OK(
+          MakeGroupedAggregator(aggregate, schema_->field(index)->type(), &aggregator));
+      std::string name = aggregate.name;
+      if (name.empty()) {
+        name = std::string(AggregateKindName(aggregate.kind)) + "(" + aggregate.target +
+               ")";
+      }
+      out_fields.push_back(::arrow::field(name, aggregator->out_type()));
+      aggregate_indices_.push_back(index);
+      aggregators_.push_back(std::move(aggregator));
+    }
+
+    out_schema_ = ::arrow::schema(std::move(out_fields));
+    return Status::OK();
+  }
+
+  Status Consume(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Batch schema ", *batch.schema(),
+                             " does not match GroupBy schema ", *schema_);
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    for (int index : key_indices_) {
+      keys.push_back(batch.column_data(index));
+    }
+    RETURN_NOT_OK(grouper_->Consume(keys, batch.num_rows(), &group_ids_));
+
+    for (size_t a = 0; a < aggregators_.size(); a++) {
+      aggregators_[a]->Resize(grouper_->num_groups());
+      aggregators_[a]->Consume(*batch.column_data(aggregate_indices_[a]),
+                               group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Merge(HashGroupBy* other) override {
+    auto other_impl = checked_cast<HashGroupByImpl*>(other);
+    if (!other_impl->out_schema_->Equals(*out_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot merge GroupBy producing ",
+                             *other_impl->out_schema_, " into GroupBy producing ",
+                             *out_schema_);
+    }
+
+    // The groups of other are mapped to groups of this instance by their keys
+    std::vector<std::shared_ptr<Array>> keys;
+    RETURN_NOT_OK(other_impl->grouper_->GetKeys(&keys));
+    std::vector<std::shared_ptr<ArrayData>> keys_data;
+    for (const auto& key : keys) {
+      keys_data.push_back(key->data());
+    }
+    RETURN_NOT_OK(
+        grouper_->Consume(keys_data, other_impl->grouper_->num_groups(), &group_ids_));
+
+    for (size_t a = 0; a < aggregators_.size(); a++) {
+      aggregators_[a]->Resize(grouper_->num_groups());
+      other_impl->aggregators_[a]->Resize(other_impl->grouper_->num_groups());
+      aggregators_[a]->Merge(*other_impl->aggregators_[a], group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(grouper_->GetKeys(&columns));
+
+    for (const auto& aggregator : aggregators_) {
+      aggregator->Resize(grouper_->num_groups());
+      std::shared_ptr<ArrayData> column;
+      RETURN_NOT_OK(aggregator->Finalize(ctx_->memory_pool(), &column));
+      columns.push_back(MakeArray(column));
+    }
+
+    *out = RecordBatch::Make(out_schema_, grouper_->num_groups(), std::move(columns));
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return grouper_->num_groups(); }
+
+  std::shared_ptr<Schema> out_schema() const override { return out_schema_; }
+
+ private:
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Schema> out_schema_;
+
+  std::vector<int> key_indices_;
+  std::unique_ptr<detail::Grouper> grouper_;
+
+  std::vector<int> aggregate_indices_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+
+  // Scratch space reused across batches
+  std::vector<int32_t> group_ids_;
+};
+
+}  // namespace
+
+Status HashGroupBy::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                         const std::vector<std::string>& keys,
+                         const std::vector<GroupByAggregate>& aggregates,
+                         const GroupByOptions& options,
+                         std::unique_ptr<HashGroupBy>* out) {
+  std::unique_ptr<HashGroupByImpl> impl(new HashGroupByImpl(ctx, schema));
+  RETURN_NOT_OK(impl->Init(keys, aggregates));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const RecordBatch& batch,
+               const std::vector<std::string>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<HashGroupBy> group_by;
+  RETURN_NOT_OK(
+      HashGroupBy::Make(ctx, batch.schema(), keys, aggregates, options, &group_by));
+  RETURN_NOT_OK(group_by->Consume(batch));
+  return group_by->Finish(out);
+}
+
+Status GroupBy(FunctionContext* ctx, const Table& table,
+               const std::vector<std::string>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<Table>* out) {
+  std::unique_ptr<HashGroupBy> group_by;
+  RETURN_NOT_OK(
+      HashGroupBy::Make(ctx, table.schema(), keys, aggregates, options, &group_by));
+
+  TableBatchReader reader(table);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  if (options.use_threads) {
+    reader.set_chunksize(options.morsel_size);
+  }
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  const int num_workers =
+      options.use_threads
+          ? std::min(GetCpuThreadPoolCapacity(), static_cast<int>(batches.size()))
+          : 1;
+  if (num_workers <= 1) {
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(group_by->Consume(*batch));
+    }
+  } else {
+    // Each worker aggregates a contiguous range of batches into a partial
+    // result of its own, with its own context.  The partial results are then
+    // merged pairwise, each into the one covering the batches just before
+    // its own, so that groups keep their order of first appearance.
+    std::vector<std::unique_ptr<FunctionContext>> contexts(num_workers);
+    std::vector<std::unique_ptr<HashGroupBy>> partials(num_workers);
+    partials[0] = std::move(group_by);
+    for (int i = 1; i < num_workers; i++) {
+      contexts[i].reset(new FunctionContext(ctx->memory_pool()));
+      RETURN_NOT_OK(HashGroupBy::Make(contexts[i].get(), table.schema(), keys,
+                                      aggregates, options, &partials[i]));
+    }
+
+    auto task_group = TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+    for (int i = 0; i < num_workers; i++) {
+      const size_t begin = batches.size() * i / num_workers;
+      const size_t end = batches.size() * (i + 1) / num_workers;
+      task_group->Append([&, i, begin, end] {
+        for (size_t j = begin; j < end; j++) {
+          RETURN_NOT_OK(partials[i]->Consume(*batches[j]));
+        }
+        return Status::OK();
+      });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+
+    for (int stride = 1; stride < num_workers; stride *= 2) {
+      task_group = TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+      for (int i = 0; i + stride < num_workers; i += 2 * stride) {
+        task_group->Append(
+            [&, i, stride] { return partials[i]->Merge(partials[i + stride].get()); });
+      }
+      RETURN_NOT_OK(task_group->Finish());
+    }
+    for (int i = 1; i < num_workers; i++) {
+      RETURN_NOT_OK(contexts[i]->status());
+    }
+    group_by = std::move(partials[0]);
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  RETURN_NOT_OK(group_by->Finish(&result));
+  return Table::FromRecordBatches(result->schema(), {result}, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
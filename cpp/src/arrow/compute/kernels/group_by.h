@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Description of a single aggregation computed by GroupBy
+struct ARROW_EXPORT GroupByAggregate {
+  enum Kind {
+    /// Sum of the non-null values, null if the group has no non-null value.
+    SUM = 0,
+    /// Number of non-null values.
+    COUNT,
+    /// Minimum of the non-null values, null if the group has no non-null value.
+    MIN,
+    /// Maximum of the non-null values, null if the group has no non-null value.
+    MAX,
+    /// Arithmetic mean of the non-null values, as double.
+    MEAN,
+  };
+
+  GroupByAggregate(Kind kind, std::string target, std::string name = "")
+      : kind(kind), target(std::move(target)), name(std::move(name)) {}
+
+  Kind kind;
+  /// Name of the aggregated input column
+  std::string target;
+  /// Name of the output column, defaults to "<kind>(<target>)" if empty
+  std::string name;
+};
+
+struct ARROW_EXPORT GroupByOptions {
+  /// Aggregate tables on the CPU thread pool, one partial result per worker
+  /// thread over a contiguous range of batches, merging the partial results
+  /// in batch order at the end
+  bool use_threads = false;
+  /// Maximum number of rows handed to a worker thread at a time
+  int64_t morsel_size = 1 << 16;
+};
+
+/// \brief Incremental hash aggregation of record batches grouped by key columns
+///
+/// Each consumed batch is first mapped to dense group ids, one hash lookup per
+/// key column and row, and the per-group aggregation states are then updated
+/// column by column from those ids.  Null keys form a group of their own.
+///
+/// The output has one row per distinct key combination, in order of first
+/// appearance, with the key columns followed by the aggregate columns.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT HashGroupBy {
+ public:
+  virtual ~HashGroupBy() = default;
+
+  /// \brief Update the groups and aggregation states from a batch
+  ///
+  /// The batch must have the schema this instance was created with.
+  virtual Status Consume(const RecordBatch& batch) = 0;
+
+  /// \brief Merge the groups and aggregation states of another instance
+  ///
+  /// other must have been created with the same schema, keys and aggregates,
+  /// and is left in an unspecified state.  Instances consuming disjoint parts
+  /// of the input, e.g. on different threads, can thus be combined.  Groups
+  /// of other not seen by this instance are appended after its own.
+  virtual Status Merge(HashGroupBy* other) = 0;
+
+  /// \brief Produce the aggregation result for all batches consumed so far
+  virtual Status Finish(std::shared_ptr<RecordBatch>* out) = 0;
+
+  /// \brief Number of distinct groups seen so far
+  virtual int64_t num_groups() const = 0;
+
+  /// \brief Schema of the batch produced by Finish()
+  virtual std::shared_ptr<Schema> out_schema() const = 0;
+
+  /// \brief factory for HashGroupBy
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] schema schema of the batches to be consumed
+  /// \param[in] keys names of the columns to group by
+  /// \param[in] aggregates aggregations to compute for each group
+  /// \param[in] options group by options
+  /// \param[out] out created instance
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const std::vector<std::string>& keys,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const GroupByOptions& options, std::unique_ptr<HashGroupBy>* out);
+};
+
+/// \brief Group a record batch by key columns and aggregate the other columns
+///
+/// For example given a batch {"k": ["a", "b", "a", null], "v": [1, 2, 3, 4]},
+/// keys = ["k"] and aggregates = [SUM("v")], the output will be
+/// {"k": ["a", "b", null], "sum(v)": [4, 2, 4]}
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to group
+/// \param[in] keys names of the columns to group by
+/// \param[in] aggregates aggregations to compute for each group
+/// \param[in] options group by options
+/// \param[out] out one row per group
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const RecordBatch& batch,
+               const std::vector<std::string>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<RecordBatch>* out);
+
+/// \brief Group a table by key columns and aggregate the other columns
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to group
+/// \param[in] keys names of the columns to group by
+/// \param[in] aggregates aggregations to compute for each group
+/// \param[in] options group by options
+/// \param[out] out one row per group, as a single-chunk table
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const Table& table,
+               const std::vector<std::string>& keys,
+               const std::vector<GroupByAggregate>& aggregates,
+               const GroupByOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void AssertGroupBy(const std::shared_ptr<Schema>& schm, const std::string& batch_json,
+                     const std::vector<std::string>& keys,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::shared_ptr<Schema>& out_schm,
+                     const std::string& expected_json) {
+    std::shared_ptr<RecordBatch> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, *RecordBatchFromJSON(schm, batch_json), keys,
+                      aggregates, GroupByOptions(), &actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(out_schm, expected_json), *actual);
+  }
+
+  void AssertGroupByTable(const std::shared_ptr<Schema>& schm,
+                          const std::vector<std::string>& table_json,
+                          const std::vector<std::string>& keys,
+                          const std::vector<GroupByAggregate>& aggregates,
+                          const std::shared_ptr<Schema>& out_schm,
+                          const std::string& expected_json) {
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, *TableFromJSON(schm, table_json), keys, aggregates,
+                      GroupByOptions(), &actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_TABLES_EQUAL(*TableFromJSON(out_schm, {expected_json}), *actual);
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto schm = schema({field("k", utf8()), field("v", int32())});
+  auto batch_json = R"([
+    {"k": "a", "v": 1},
+    {"k": "b", "v": 2},
+    {"k": "a", "v": 3},
+    {"k": null, "v": 4},
+    {"k": "b", "v": null},
+    {"k": "c", "v": null}
+  ])";
+
+  this->AssertGroupBy(
+      schm, batch_json, {"k"},
+      {{GroupByAggregate::SUM, "v"},
+       {GroupByAggregate::COUNT, "v"},
+       {GroupByAggregate::MIN, "v"},
+       {GroupByAggregate::MAX, "v", "max_v"},
+       {GroupByAggregate::MEAN, "v"}},
+      schema({field("k", utf8()), field("sum(v)", int64()), field("count(v)", int64()),
+              field("min(v)", int32()), field("max_v", int32()),
+              field("mean(v)", float64())}),
+      R"json([
+    {"k": "a", "sum(v)": 4, "count(v)": 2, "min(v)": 1, "max_v": 3, "mean(v)": 2.0},
+    {"k": "b", "sum(v)": 2, "count(v)": 1, "min(v)": 2, "max_v": 2, "mean(v)": 2.0},
+    {"k": null, "sum(v)": 4, "count(v)": 1, "min(v)": 4, "max_v": 4, "mean(v)": 4.0},
+    {"k": "c", "sum(v)": null, "count(v)": 0, "min(v)": null, "max_v": null,
+     "mean(v)": null}
+  ])json");
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto schm = schema({field("a", int64()), field("b", boolean()), field("v", float64())});
+  auto batch_json = R"([
+    {"a": 1, "b": true, "v": 1.5},
+    {"a": 1, "b": false, "v": 2.5},
+    {"a": 2, "b": true, "v": -1.0},
+    {"a": 1, "b": true, "v": 0.5},
+    {"a": null, "b": false, "v": 4.0},
+    {"a": 2, "b": true, "v": 3.0},
+    {"a": null, "b": false, "v": null}
+  ])";
+
+  this->AssertGroupBy(
+      schm, batch_json, {"a", "b"},
+      {{GroupByAggregate::SUM, "v"}, {GroupByAggregate::MIN, "v"}},
+      schema({field("a", int64()), field("b", boolean()), field("sum(v)", float64()),
+              field("min(v)", float64())}),
+      R"json([
+    {"a": 1, "b": true, "sum(v)": 2.0, "min(v)": 0.5},
+    {"a": 1, "b": false, "sum(v)": 2.5, "min(v)": 2.5},
+    {"a": 2, "b": true, "sum(v)": 2.0, "min(v)": -1.0},
+    {"a": null, "b": false, "sum(v)": 4.0, "min(v)": 4.0}
+  ])json");
+}
+
+TEST_F(TestGroupBy, Table) {
+  auto schm = schema({field("k", int32()), field("v", uint8())});
+  std::vector<std::string> table_json = {
+      R"([{"k": 3, "v": 1}, {"k": 1, "v": 2}])",
+      R"([{"k": 3, "v": 3}])",
+      R"([{"k": 2, "v": 4}, {"k": 1, "v": 5}, {"k": 3, "v": null}])"};
+
+  this->AssertGroupByTable(schm, table_json, {"k"},
+                           {{GroupByAggregate::SUM, "v"}, {GroupByAggregate::COUNT, "v"}},
+                           schema({field("k", int32()), field("sum(v)", uint64()),
+                                   field("count(v)", int64())}),
+                           R"json([
+    {"k": 3, "sum(v)": 4, "count(v)": 2},
+    {"k": 1, "sum(v)": 7, "count(v)": 2},
+    {"k": 2, "sum(v)": 4, "count(v)": 1}
+  ])json");
+
+  this->AssertGroupByTable(schm, {"[]"}, {"k"}, {{GroupByAggregate::SUM, "v"}},
+                           schema({field("k", int32()), field("sum(v)", uint64())}),
+                           "[]");
+}
+
+TEST_F(TestGroupBy, Merge) {
+  auto schm = schema({field("k", utf8()), field("v", int16())});
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, "v"},
+                                              {GroupByAggregate::COUNT, "v"},
+                                              {GroupByAggregate::MIN, "v"},
+                                              {GroupByAggregate::MAX, "v"}};
+
+  std::unique_ptr<HashGroupBy> left, right;
+  ASSERT_OK(HashGroupBy::Make(&this->ctx_, schm, {"k"}, aggregates, GroupByOptions(),
+                              &left));
+  ASSERT_OK(HashGroupBy::Make(&this->ctx_, schm, {"k"}, aggregates, GroupByOptions(),
+                              &right));
+  ASSERT_OK(left->Consume(*RecordBatchFromJSON(schm, R"([
+    {"k": "a", "v": 1},
+    {"k": "b", "v": null},
+    {"k": null, "v": 5}
+  ])")));
+  ASSERT_OK(right->Consume(*RecordBatchFromJSON(schm, R"([
+    {"k": "c", "v": 7},
+    {"k": "b", "v": 2},
+    {"k": "a", "v": -3},
+    {"k": null, "v": null}
+  ])")));
+
+  ASSERT_OK(left->Merge(right.get()));
+  ASSERT_EQ(4, left->num_groups());
+
+  std::shared_ptr<RecordBatch> actual;
+  ASSERT_OK(left->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  auto expected_schm =
+      schema({field("k", utf8()), field("sum(v)", int64()), field("count(v)", int64()),
+              field("min(v)", int16()), field("max(v)", int16())});
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(expected_schm, R"json([
+    {"k": "a", "sum(v)": -2, "count(v)": 2, "min(v)": -3, "max(v)": 1},
+    {"k": "b", "sum(v)": 2, "count(v)": 1, "min(v)": 2, "max(v)": 2},
+    {"k": null, "sum(v)": 5, "count(v)": 1, "min(v)": 5, "max(v)": 5},
+    {"k": "c", "sum(v)": 7, "count(v)": 1, "min(v)": 7, "max(v)": 7}
+  ])json"),
+                       *actual);
+
+  std::unique_ptr<HashGroupBy> other;
+  ASSERT_OK(HashGroupBy::Make(&this->ctx_, schm, {"v"}, {}, GroupByOptions(), &other));
+  ASSERT_RAISES(Invalid, left->Merge(other.get()));
+}
+
+TEST_F(TestGroupBy, TableUseThreads) {
+  auto schm = schema({field("k", int32()), field("v", float64())});
+  std::vector<std::string> table_json = {
+      R"([{"k": 3, "v": 1}, {"k": 1, "v": 2}, {"k": 3, "v": 3}, {"k": 2, "v": 4}])",
+      R"([{"k": 1, "v": 5}, {"k": null, "v": 6}, {"k": 4, "v": 7}])",
+      R"([{"k": 2, "v": 8}, {"k": 3, "v": null}, {"k": null, "v": 10}])"};
+  auto table = TableFromJSON(schm, table_json);
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, "v"},
+                                              {GroupByAggregate::MEAN, "v"},
+                                              {GroupByAggregate::MAX, "v"}};
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, {"k"}, aggregates, GroupByOptions(),
+                    &expected));
+
+  GroupByOptions options;
+  options.use_threads = true;
+  options.morsel_size = 2;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, {"k"}, aggregates, options, &actual));
+  ASSERT_OK(actual->ValidateFull());
+
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, TableUseThreadsManyChunks) {
+  // More chunks than threads, so that workers consume several batches each
+  // and every partial result is merged; new keys appear in every chunk
+  auto schm = schema({field("k", int32()), field("v", int64())});
+  const int num_chunks = 4 * GetCpuThreadPoolCapacity() + 3;
+  std::vector<std::string> table_json;
+  for (int c = 0; c < num_chunks; c++) {
+    table_json.push_back("[{\"k\": " + std::to_string(c * 7 % num_chunks) +
+                         ", \"v\": " + std::to_string(c) + "}, {\"k\": " +
+                         std::to_string(c / 3) + ", \"v\": 1}]");
+  }
+  auto table = TableFromJSON(schm, table_json);
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::SUM, "v"},
+                                              {GroupByAggregate::COUNT, "v"}};
+
+  std::shared_ptr<Table> expected, actual;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, {"k"}, aggregates, GroupByOptions(),
+                    &expected));
+
+  GroupByOptions options;
+  options.use_threads = true;
+  options.morsel_size = 2;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, {"k"}, aggregates, options, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto batch = RecordBatchFromJSON(schema({field("k", utf8()), field("v", utf8())}),
+                                   R"([{"k": "a", "v": "x"}])");
+  std::shared_ptr<RecordBatch> out;
+
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, *batch, {}, {}, GroupByOptions(), &out));
+  ASSERT_RAISES(Invalid,
+                GroupBy(&this->ctx_, *batch, {"z"}, {}, GroupByOptions(), &out));
+  ASSERT_RAISES(NotImplemented, GroupBy(&this->ctx_, *batch, {"k"},
+                                        {{GroupByAggregate::SUM, "v"}},
+                                        GroupByOptions(), &out));
+  ASSERT_OK(GroupBy(&this->ctx_, *batch, {"k"}, {{GroupByAggregate::COUNT, "v"}},
+                    GroupByOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/grouper_internal.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::DictionaryTraits;
+using internal::HashTraits;
+using internal::kKeyNotFound;
+
+namespace compute {
+namespace detail {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+
+// Maps the values of a key column to dense ids in order of first appearance.
+// A null key is assigned an id of its own.
+class GroupKeyEncoder {
+ public:
+  virtual ~GroupKeyEncoder() = default;
+
+  // Write the id of each of the data.length values to ids
+  virtual Status Encode(const ArrayData& data, int32_t* ids) = 0;
+
+  // Write the id of each of the data.length values to ids, without assigning
+  // new ids: nulls and unseen values are written as kKeyNotFound
+  virtual void Lookup(const ArrayData& data, int32_t* ids) const = 0;
+
+  // The distinct values seen so far, the value with id i at position i
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) = 0;
+};
+
+template <typename Type>
+class TypedGroupKeyEncoder : public GroupKeyEncoder {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+  using Scalar = typename internal::ArrayDataInlineVisitor<Type>::c_type;
+
+  TypedGroupKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    return VisitArrayDataInline<Type>(data, [&](util::optional<Scalar> v) {
+      if (v.has_value()) {
+        return memo_table_.GetOrInsert(*v, ids++);
+      }
+      *ids++ = memo_table_.GetOrInsertNull();
+      return Status::OK();
+    });
+  }
+
+  void Lookup(const ArrayData& data, int32_t* ids) const override {
+    VisitArrayDataInline<Type>(data, [&](util::optional<Scalar> v) {
+      *ids++ = v.has_value() ? memo_table_.Get(*v) : kKeyNotFound;
+    });
+  }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+};
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(LargeBinaryType)                   \
+  PROCESS(StringType)                        \
+  PROCESS(LargeStringType)                   \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+Status MakeGroupKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                           std::unique_ptr<GroupKeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                       \
+  case InType::type_id:                                       \
+    out->reset(new TypedGroupKeyEncoder<InType>(type, pool)); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Grouping by keys of type ", *type);
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Grouper implementation
+
+class GrouperImpl : public Grouper {
+ public:
+  explicit GrouperImpl(FunctionContext* ctx) : ctx_(ctx) {}
+
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types) {
+    if (key_types.empty()) {
+      return Status::Invalid("Grouping requires at least one key column");
+    }
+    for (const auto& type : key_types) {
+      std::unique_ptr<GroupKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeGroupKeyEncoder(type, ctx_->memory_pool(), &encoder));
+      encoders_.push_back(std::move(encoder));
+    }
+    // Combining key ids pairwise, see Consume()
+    for (size_t i = 1; i < key_types.size(); i++) {
+      pair_memo_tables_.emplace_back(
+          new internal::ScalarMemoTable<uint64_t>(ctx_->memory_pool(), 0));
+    }
+    key_ids_.resize(key_types.size());
+    group_key_ids_.resize(key_types.size());
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<ArrayData>>& keys, int64_t length,
+                 std::vector<int32_t>* group_ids) override {
+    DCHECK_EQ(keys.size(), encoders_.size());
+    for (size_t k = 0; k < encoders_.size(); k++) {
+      key_ids_[k].resize(length);
+      RETURN_NOT_OK(encoders_[k]->Encode(*keys[k], key_ids_[k].data()));
+    }
+
+    // The group id of a row is obtained by folding its key ids from left to
+    // right: the (id so far, next key id) pair is looked up in a memo table per
+    // key column, which assigns dense ids to the distinct prefixes of the key.
+    group_ids->resize(length);
+    const int32_t* first_ids = key_ids_[0].data();
+    for (int64_t i = 0; i < length; i++) {
+      int32_t group_id = first_ids[i];
+      for (size_t k = 1; k < encoders_.size(); k++) {
+        RETURN_NOT_OK(pair_memo_tables_[k - 1]->GetOrInsert(
+            PairKey(group_id, key_ids_[k][i]), &group_id));
+      }
+      // Memo tables hand out ids in order of first appearance
+      if (group_id == num_groups_) {
+        for (size_t k = 0; k < encoders_.size(); k++) {
+          group_key_ids_[k].push_back(key_ids_[k][i]);
+        }
+        ++num_groups_;
+      }
+      (*group_ids)[i] = group_id;
+    }
+    return Status::OK();
+  }
+
+  Status Lookup(const std::vector<std::shared_ptr<ArrayData>>& keys, int64_t length,
+                std::vector<int32_t>* group_ids) override {
+    DCHECK_EQ(keys.size(), encoders_.size());
+    // Lookups don't modify any state, so that they can run concurrently
+    std::vector<std::vector<int32_t>> key_ids(encoders_.size());
+    for (size_t k = 0; k < encoders_.size(); k++) {
+      key_ids[k].resize(length);
+      encoders_[k]->Lookup(*keys[k], key_ids[k].data());
+    }
+
+    group_ids->resize(length);
+    const int32_t* first_ids = key_ids[0].data();
+    for (int64_t i = 0; i < length; i++) {
+      int32_t group_id = first_ids[i];
+      for (size_t k = 1; k < encoders_.size() && group_id != kKeyNotFound; k++) {
+        group_id = key_ids[k][i] == kKeyNotFound
+                       ? kKeyNotFound
+                       : pair_memo_tables_[k - 1]->Get(PairKey(group_id, key_ids[k][i]));
+      }
+      (*group_ids)[i] = group_id;
+    }
+    return Status::OK();
+  }
+
+  Status GetKeys(std::vector<std::shared_ptr<Array>>* out) override {
+    out->clear();
+    // Key columns are gathered from the distinct values of each key
+    for (size_t k = 0; k < encoders_.size(); k++) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(encoders_[k]->GetUniques(&uniques));
+
+      std::shared_ptr<Buffer> indices_buffer;
+      RETURN_NOT_OK(ctx_->Allocate(num_groups_ * sizeof(int32_t), &indices_buffer));
+      if (num_groups_ > 0) {
+        std::memcpy(indices_buffer->mutable_data(), group_key_ids_[k].data(),
+                    num_groups_ * sizeof(int32_t));
+      }
+      Int32Array indices(num_groups_, indices_buffer);
+
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(Take(ctx_, *MakeArray(uniques), indices, TakeOptions(), &column));
+      out->push_back(std::move(column));
+    }
+    return Status::OK();
+  }
+
+  int32_t num_groups() const override { return num_groups_; }
+
+ private:
+  static uint64_t PairKey(int32_t left, int32_t right) {
+    return (static_cast<uint64_t>(left) << 32) | static_cast<uint32_t>(right);
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::unique_ptr<GroupKeyEncoder>> encoders_;
+  std::vector<std::unique_ptr<internal::ScalarMemoTable<uint64_t>>> pair_memo_tables_;
+  // For each key column, the key id of each group
+  std::vector<std::vector<int32_t>> group_key_ids_;
+  int32_t num_groups_ = 0;
+
+  // Scratch space reused across calls
+  std::vector<std::vector<int32_t>> key_ids_;
+};
+
+}  // namespace
+
+Status Grouper::Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     std::unique_ptr<Grouper>* out) {
+  std::unique_ptr<GrouperImpl> impl(new GrouperImpl(ctx));
+  RETURN_NOT_OK(impl->Init(key_types));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+struct ArrayData;
+
+namespace compute {
+
+class FunctionContext;
+
+namespace detail {
+
+/// \brief Map the rows of one or more key columns to dense group ids
+///
+/// Group ids are assigned in order of first appearance.  A null is a key
+/// value of its own when grouping, but never matches when looking up.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// \brief Compute the group id of each of the length rows of keys into
+  /// group_ids, creating new groups as needed
+  virtual Status Consume(const std::vector<std::shared_ptr<ArrayData>>& keys,
+                         int64_t length, std::vector<int32_t>* group_ids) = 0;
+
+  /// \brief Look up the group id of each of the length rows of keys into
+  /// group_ids, -1 for rows with a null or an unseen key
+  ///
+  /// Lookups may run concurrently with each other, but not with Consume.
+  virtual Status Lookup(const std::vector<std::shared_ptr<ArrayData>>& keys,
+                        int64_t length, std::vector<int32_t>* group_ids) = 0;
+
+  /// \brief The key columns of all groups, ordered by group id
+  virtual Status GetKeys(std::vector<std::shared_ptr<Array>>* out) = 0;
+
+  /// \brief Number of groups created so far
+  virtual int32_t num_groups() const = 0;
+
+  /// \brief factory for Groupers
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types the types of the key columns
+  /// \param[out] out created Grouper
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     std::unique_ptr<Grouper>* out);
+};
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
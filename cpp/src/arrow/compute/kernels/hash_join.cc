@@ -0,0 +1,234 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+Status FindKeyColumns(const RecordBatch& batch, const std::vector<std::string>& names,
+                      std::vector<std::shared_ptr<ArrayData>>* out) {
+  out->clear();
+  for (const auto& name : names) {
+    int index = batch.schema()->GetFieldIndex(name);
+    if (index < 0) {
+      return Status::Invalid("No unique column named '", name, "' in schema ",
+                             *batch.schema());
+    }
+    out->push_back(batch.column_data(index));
+  }
+  return Status::OK();
+}
+
+class JoinHashTableImpl : public JoinHashTable {
+ public:
+  JoinHashTableImpl(FunctionContext* ctx, const std::shared_ptr<RecordBatch>& build)
+      : ctx_(ctx), build_(build) {}
+
+  Status Init(const std::vector<std::string>& build_keys) {
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    RETURN_NOT_OK(FindKeyColumns(*build_, build_keys, &keys));
+    for (const auto& key : keys) {
+      key_types_.push_back(key->type);
+    }
+    RETURN_NOT_OK(detail::Grouper::Make(ctx_, key_types_, &grouper_));
+
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(grouper_->Consume(keys, build_->num_rows(), &group_ids));
+
+    // Lay out the build rows of each group contiguously, in row order:
+    // the rows of group g are group_rows_[group_offsets_[g]:group_offsets_[g + 1]]
+    const int32_t num_groups = grouper_->num_groups();
+    group_offsets_.assign(num_groups + 1, 0);
+    for (int32_t group_id : group_ids) {
+      ++group_offsets_[group_id + 1];
+    }
+    for (int32_t g = 0; g < num_groups; g++) {
+      group_offsets_[g + 1] += group_offsets_[g];
+    }
+    std::vector<int64_t> cursors(group_offsets_.begin(), group_offsets_.end() - 1);
+    group_rows_.resize(group_ids.size());
+    for (int64_t row = 0; row < static_cast<int64_t>(group_ids.size()); row++) {
+      group_rows_[cursors[group_ids[row]]++] = row;
+    }
+    return Status::OK();
+  }
+
+  Status Probe(const RecordBatch& probe, const std::vector<std::string>& probe_keys,
+               const JoinOptions& options, std::shared_ptr<Array>* probe_indices,
+               std::shared_ptr<Array>* build_indices) override {
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    RETURN_NOT_OK(FindKeyColumns(probe, probe_keys, &keys));
+    if (keys.size() != key_types_.size()) {
+      return Status::Invalid("Expected ", key_types_.size(),
+                             " probe key columns, got ", keys.size());
+    }
+    for (size_t k = 0; k < keys.size(); k++) {
+      if (!keys[k]->type->Equals(*key_types_[k])) {
+        return Status::TypeError("Probe key column '", probe_keys[k], "' has type ",
+                                 *keys[k]->type, ", expected ", *key_types_[k]);
+      }
+    }
+
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(grouper_->Lookup(keys, probe.num_rows(), &group_ids));
+
+    switch (options.type) {
+      case JoinOptions::INNER:
+      case JoinOptions::LEFT_OUTER:
+        return ProbeMatches(group_ids, options.type == JoinOptions::LEFT_OUTER,
+                            probe_indices, build_indices);
+      case JoinOptions::LEFT_SEMI:
+      case JoinOptions::LEFT_ANTI:
+        build_indices->reset();
+        return ProbeFilter(group_ids, options.type == JoinOptions::LEFT_SEMI,
+                           probe_indices);
+    }
+    return Status::Invalid("Unknown join type");
+  }
+
+  Status Join(const RecordBatch& probe, const std::vector<std::string>& probe_keys,
+              const JoinOptions& options, std::shared_ptr<RecordBatch>* out) override {
+    return Join(ctx_, probe, probe_keys, options, out);
+  }
+
+  Status Join(FunctionContext* ctx, const RecordBatch& probe,
+              const std::vector<std::string>& probe_keys, const JoinOptions& options,
+              std::shared_ptr<RecordBatch>* out) override {
+    std::shared_ptr<Array> probe_indices, build_indices;
+    RETURN_NOT_OK(Probe(probe, probe_keys, options, &probe_indices, &build_indices));
+
+    std::vector<std::shared_ptr<Field>> fields = probe.schema()->fields();
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < probe.num_columns(); i++) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(
+          Take(ctx, *probe.column(i), *probe_indices, TakeOptions(), &column));
+      columns.push_back(std::move(column));
+    }
+    if (build_indices != nullptr) {
+      const bool outer = options.type == JoinOptions::LEFT_OUTER;
+      for (int i = 0; i < build_->num_columns(); i++) {
+        std::shared_ptr<Array> column;
+        RETURN_NOT_OK(
+            Take(ctx, *build_->column(i), *build_indices, TakeOptions(), &column));
+        columns.push_back(std::move(column));
+        const auto& field = build_->schema()->field(i);
+        fields.push_back(outer ? field->WithNullable(true) : field);
+      }
+    }
+
+    *out = RecordBatch::Make(schema(std::move(fields)), probe_indices->length(),
+                             std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  Status ProbeMatches(const std::vector<int32_t>& group_ids, bool outer,
+                      std::shared_ptr<Array>* probe_indices,
+                      std::shared_ptr<Array>* build_indices) {
+    // Size the output exactly before filling it
+    int64_t length = 0;
+    for (int32_t group_id : group_ids) {
+      if (group_id >= 0) {
+        length += group_offsets_[group_id + 1] - group_offsets_[group_id];
+      } else if (outer) {
+        ++length;
+      }
+    }
+
+    Int64Builder probe_builder(ctx_->memory_pool());
+    Int64Builder build_builder(ctx_->memory_pool());
+    RETURN_NOT_OK(probe_builder.Reserve(length));
+    RETURN_NOT_OK(build_builder.Reserve(length));
+    for (int64_t row = 0; row < static_cast<int64_t>(group_ids.size()); row++) {
+      const int32_t group_id = group_ids[row];
+      if (group_id >= 0) {
+        for (int64_t i = group_offsets_[group_id]; i < group_offsets_[group_id + 1];
+             i++) {
+          probe_builder.UnsafeAppend(row);
+          build_builder.UnsafeAppend(group_rows_[i]);
+        }
+      } else if (outer) {
+        probe_builder.UnsafeAppend(row);
+        build_builder.UnsafeAppendNull();
+      }
+    }
+    RETURN_NOT_OK(probe_builder.Finish(probe_indices));
+    return build_builder.Finish(build_indices);
+  }
+
+  Status ProbeFilter(const std::vector<int32_t>& group_ids, bool keep_matches,
+                     std::shared_ptr<Array>* probe_indices) {
+    Int64Builder probe_builder(ctx_->memory_pool());
+    RETURN_NOT_OK(probe_builder.Reserve(group_ids.size()));
+    for (int64_t row = 0; row < static_cast<int64_t>(group_ids.size()); row++) {
+      if ((group_ids[row] >= 0) == keep_matches) {
+        probe_builder.UnsafeAppend(row);
+      }
+    }
+    return probe_builder.Finish(probe_indices);
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<RecordBatch> build_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::unique_ptr<detail::Grouper> grouper_;
+  std::vector<int64_t> group_offsets_;
+  std::vector<int64_t> group_rows_;
+};
+
+}  // namespace
+
+Status JoinHashTable::Make(FunctionContext* ctx,
+                           const std::shared_ptr<RecordBatch>& build,
+                           const std::vector<std::string>& build_keys,
+                           std::unique_ptr<JoinHashTable>* out) {
+  std::unique_ptr<JoinHashTableImpl> impl(new JoinHashTableImpl(ctx, build));
+  RETURN_NOT_OK(impl->Init(build_keys));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status HashJoin(FunctionContext* ctx, const RecordBatch& left,
+                const std::shared_ptr<RecordBatch>& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys, const JoinOptions& options,
+                std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<JoinHashTable> table;
+  RETURN_NOT_OK(JoinHashTable::Make(ctx, right, right_keys, &table));
+  return table->Join(left, left_keys, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT JoinOptions {
+  enum JoinType {
+    /// Emit a row for each matching pair of left and right rows.
+    INNER = 0,
+    /// As INNER, plus a row with nulls on the right side for each left row
+    /// without any match.
+    LEFT_OUTER,
+    /// Emit each left row having at least one match, once.
+    LEFT_SEMI,
+    /// Emit each left row having no match.
+    LEFT_ANTI,
+  };
+
+  JoinOptions() {}
+  explicit JoinOptions(JoinType type) : type(type) {}
+
+  JoinType type = INNER;
+};
+
+/// \brief Hash table over the key columns of a record batch, to be probed by
+/// other record batches
+///
+/// The table is built once and can then be probed by any number of batches,
+/// e.g. a dimension table joined to a stream of fact batches.  Keys are
+/// compared for equality, a null key never matches.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT JoinHashTable {
+ public:
+  virtual ~JoinHashTable() = default;
+
+  /// \brief Compute the row indices of the matches of a probe batch
+  ///
+  /// Probe and Join may be called concurrently, e.g. by threads probing
+  /// disjoint batches.
+  ///
+  /// Matches of a probe row are emitted in order of build row.  For
+  /// LEFT_SEMI and LEFT_ANTI joins build_indices is set to null.  For
+  /// LEFT_OUTER joins build_indices is null for probe rows without any match.
+  ///
+  /// \param[in] probe record batch to probe the table with
+  /// \param[in] probe_keys names of the probe key columns, matching the types
+  ///            of the build key columns
+  /// \param[in] options join options
+  /// \param[out] probe_indices int64 indices of the output rows in probe
+  /// \param[out] build_indices int64 indices of the output rows in the build batch
+  virtual Status Probe(const RecordBatch& probe,
+                       const std::vector<std::string>& probe_keys,
+                       const JoinOptions& options, std::shared_ptr<Array>* probe_indices,
+                       std::shared_ptr<Array>* build_indices) = 0;
+
+  /// \brief Join a probe batch with the build batch
+  ///
+  /// The output has the probe columns followed, except for LEFT_SEMI and
+  /// LEFT_ANTI joins, by the build columns.
+  ///
+  /// \param[in] probe record batch to probe the table with
+  /// \param[in] probe_keys names of the probe key columns
+  /// \param[in] options join options
+  /// \param[out] out joined record batch
+  virtual Status Join(const RecordBatch& probe,
+                      const std::vector<std::string>& probe_keys,
+                      const JoinOptions& options, std::shared_ptr<RecordBatch>* out) = 0;
+
+  /// \brief As Join, with ctx instead of the context the table was made with
+  ///
+  /// A FunctionContext is not thread-safe: threads probing the table
+  /// concurrently must each pass their own.
+  virtual Status Join(FunctionContext* ctx, const RecordBatch& probe,
+                      const std::vector<std::string>& probe_keys,
+                      const JoinOptions& options, std::shared_ptr<RecordBatch>* out) = 0;
+
+  /// \brief factory for JoinHashTable
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] build record batch to build the table from
+  /// \param[in] build_keys names of the build key columns
+  /// \param[out] out created hash table
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<RecordBatch>& build,
+                     const std::vector<std::string>& build_keys,
+                     std::unique_ptr<JoinHashTable>* out);
+};
+
+/// \brief Join two record batches on equality of key columns
+///
+/// A hash table is built on the right batch and probed with the left batch.
+///
+/// For example given left = {"k": [1, 2, null, 1]}, right = {"k": [1, 3, 1], "v":
+/// ["a", "b", "c"]} and an INNER join on "k", the output will be
+/// {"k": [1, 1, 1, 1], "k": [1, 1, 1, 1], "v": ["a", "c", "a", "c"]}
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left record batch to probe with
+/// \param[in] right record batch to build the hash table from
+/// \param[in] left_keys names of the left key columns
+/// \param[in] right_keys names of the right key columns
+/// \param[in] options join options
+/// \param[out] out joined record batch
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const RecordBatch& left,
+                const std::shared_ptr<RecordBatch>& right,
+                const std::vector<std::string>& left_keys,
+                const std::vector<std::string>& right_keys, const JoinOptions& options,
+                std::shared_ptr<RecordBatch>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    left_ = RecordBatchFromJSON(schema({field("lk", int32()), field("lv", utf8())}), R"([
+      {"lk": 1, "lv": "a"},
+      {"lk": 2, "lv": "b"},
+      {"lk": null, "lv": "c"},
+      {"lk": 1, "lv": "d"},
+      {"lk": 4, "lv": "e"}
+    ])");
+    auto right_schema = schema({field("rk", int32()), field("rv", int64())});
+    right_ = RecordBatchFromJSON(right_schema, R"([
+      {"rk": 1, "rv": 10},
+      {"rk": 3, "rv": 30},
+      {"rk": null, "rv": 0},
+      {"rk": 1, "rv": 11},
+      {"rk": 4, "rv": 40}
+    ])");
+  }
+
+  void AssertJoin(JoinOptions::JoinType type, const std::shared_ptr<Schema>& out_schm,
+                  const std::string& expected_json) {
+    std::shared_ptr<RecordBatch> actual;
+    ASSERT_OK(HashJoin(&this->ctx_, *left_, right_, {"lk"}, {"rk"}, JoinOptions(type),
+                       &actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(out_schm, expected_json), *actual);
+  }
+
+  std::shared_ptr<RecordBatch> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  this->AssertJoin(JoinOptions::INNER,
+                   schema({field("lk", int32()), field("lv", utf8()),
+                           field("rk", int32()), field("rv", int64())}),
+                   R"([
+    {"lk": 1, "lv": "a", "rk": 1, "rv": 10},
+    {"lk": 1, "lv": "a", "rk": 1, "rv": 11},
+    {"lk": 1, "lv": "d", "rk": 1, "rv": 10},
+    {"lk": 1, "lv": "d", "rk": 1, "rv": 11},
+    {"lk": 4, "lv": "e", "rk": 4, "rv": 40}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  this->AssertJoin(JoinOptions::LEFT_OUTER,
+                   schema({field("lk", int32()), field("lv", utf8()),
+                           field("rk", int32()), field("rv", int64())}),
+                   R"([
+    {"lk": 1, "lv": "a", "rk": 1, "rv": 10},
+    {"lk": 1, "lv": "a", "rk": 1, "rv": 11},
+    {"lk": 2, "lv": "b", "rk": null, "rv": null},
+    {"lk": null, "lv": "c", "rk": null, "rv": null},
+    {"lk": 1, "lv": "d", "rk": 1, "rv": 10},
+    {"lk": 1, "lv": "d", "rk": 1, "rv": 11},
+    {"lk": 4, "lv": "e", "rk": 4, "rv": 40}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemiAnti) {
+  auto out_schm = schema({field("lk", int32()), field("lv", utf8())});
+  this->AssertJoin(JoinOptions::LEFT_SEMI, out_schm, R"([
+    {"lk": 1, "lv": "a"},
+    {"lk": 1, "lv": "d"},
+    {"lk": 4, "lv": "e"}
+  ])");
+  this->AssertJoin(JoinOptions::LEFT_ANTI, out_schm, R"([
+    {"lk": 2, "lv": "b"},
+    {"lk": null, "lv": "c"}
+  ])");
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = RecordBatchFromJSON(schema({field("a", utf8()), field("b", int8())}), R"([
+    {"a": "x", "b": 1},
+    {"a": "x", "b": 2},
+    {"a": "y", "b": 1}
+  ])");
+  auto right = RecordBatchFromJSON(
+      schema({field("a", utf8()), field("b", int8()), field("v", float64())}), R"([
+    {"a": "y", "b": 1, "v": 1.5},
+    {"a": "x", "b": 2, "v": 2.5},
+    {"a": "y", "b": 2, "v": 3.5}
+  ])");
+
+  std::unique_ptr<JoinHashTable> table;
+  ASSERT_OK(JoinHashTable::Make(&this->ctx_, right, {"a", "b"}, &table));
+
+  std::shared_ptr<Array> probe_indices, build_indices;
+  ASSERT_OK(table->Probe(*left, {"a", "b"}, JoinOptions(), &probe_indices,
+                         &build_indices));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2]"), *probe_indices);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 0]"), *build_indices);
+
+  ASSERT_OK(table->Probe(*left, {"a", "b"}, JoinOptions(JoinOptions::LEFT_OUTER),
+                         &probe_indices, &build_indices));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 1, 2]"), *probe_indices);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[null, 1, 0]"), *build_indices);
+
+  ASSERT_OK(table->Probe(*left, {"a", "b"}, JoinOptions(JoinOptions::LEFT_SEMI),
+                         &probe_indices, &build_indices));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2]"), *probe_indices);
+  ASSERT_EQ(nullptr, build_indices);
+}
+
+TEST_F(TestHashJoin, ConcurrentProbes) {
+  std::unique_ptr<JoinHashTable> table;
+  ASSERT_OK(JoinHashTable::Make(&this->ctx_, right_, {"rk"}, &table));
+  std::shared_ptr<RecordBatch> expected;
+  ASSERT_OK(table->Join(*left_, {"lk"}, JoinOptions(), &expected));
+
+  // Each thread probes with its own context
+  std::vector<std::shared_ptr<RecordBatch>> actual(8);
+  std::vector<Status> statuses(actual.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < actual.size(); ++i) {
+    threads.emplace_back([&, i] {
+      FunctionContext ctx(default_memory_pool());
+      statuses[i] = table->Join(&ctx, *left_, {"lk"}, JoinOptions(), &actual[i]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < actual.size(); ++i) {
+    ASSERT_OK(statuses[i]);
+    ASSERT_BATCHES_EQUAL(*expected, *actual[i]);
+  }
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, right_, {"lk"}, {"zz"},
+                                  JoinOptions(), &out));
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left_, right_, {"lk", "lv"}, {"rk"},
+                                  JoinOptions(), &out));
+  ASSERT_RAISES(TypeError, HashJoin(&this->ctx_, *left_, right_, {"lv"}, {"rk"},
+                                    JoinOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,337 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/moments.h"
+
+#include <cmath>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+enum class MomentStatistic { VARIANCE, STDDEV, SKEW, KURTOSIS };
+
+// The count and mean of some values, and the sums of the second, third and
+// fourth powers of their deviations from the mean
+struct MomentsState {
+  int64_t count = 0;
+  double mean = 0;
+  double m2 = 0;
+  double m3 = 0;
+  double m4 = 0;
+};
+
+// Merge the moments of two sets of values with the pairwise formulas of Chan et
+// al. and Pebay, which stay accurate when the sets are large and their means
+// are close
+template <bool kHigherMoments>
+static void MergeMoments(const MomentsState& src, MomentsState* dst) {
+  if (src.count == 0) {
+    return;
+  }
+  if (dst->count == 0) {
+    *dst = src;
+    return;
+  }
+  const auto na = static_cast<double>(dst->count);
+  const auto nb = static_cast<double>(src.count);
+  const double n = na + nb;
+  const double delta = src.mean - dst->mean;
+  const double delta_n = delta / n;
+  const double term = delta * delta_n * na * nb;
+
+  if (kHigherMoments) {
+    // Each higher moment depends on the lower moments before merging
+    dst->m4 += src.m4 + term * delta_n * delta_n * (na * na - na * nb + nb * nb) +
+               6 * delta_n * delta_n * (na * na * src.m2 + nb * nb * dst->m2) +
+               4 * delta_n * (na * src.m3 - nb * dst->m3);
+    dst->m3 += src.m3 + term * delta_n * (na - nb) +
+               3 * delta_n * (na * src.m2 - nb * dst->m2);
+  }
+  dst->m2 += src.m2 + term;
+  dst->mean += delta_n * nb;
+  dst->count += src.count;
+}
+
+// The moments of a block of values small enough to stay in cache, computed in
+// two passes: the mean, then the deviations from it. Each pass accumulates in
+// independent lanes so that it vectorizes.
+template <bool kHigherMoments>
+static MomentsState BlockMoments(const double* values, int64_t length) {
+  constexpr int64_t kLanes = 4;
+  const int64_t vector_length = length - length % kLanes;
+
+  double sums[kLanes] = {};
+  for (int64_t i = 0; i < vector_length; i += kLanes) {
+    for (int64_t j = 0; j < kLanes; ++j) {
+      sums[j] += values[i + j];
+    }
+  }
+  double sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  for (int64_t i = vector_length; i < length; ++i) {
+    sum += values[i];
+  }
+
+  MomentsState state;
+  state.count = length;
+  state.mean = sum / static_cast<double>(length);
+
+  double m2[kLanes] = {}, m3[kLanes] = {}, m4[kLanes] = {};
+  for (int64_t i = 0; i < vector_length; i += kLanes) {
+    for (int64_t j = 0; j < kLanes; ++j) {
+      const double d = values[i + j] - state.mean;
+      const double d2 = d * d;
+      m2[j] += d2;
+      if (kHigherMoments) {
+        m3[j] += d2 * d;
+        m4[j] += d2 * d2;
+      }
+    }
+  }
+  state.m2 = (m2[0] + m2[1]) + (m2[2] + m2[3]);
+  state.m3 = (m3[0] + m3[1]) + (m3[2] + m3[3]);
+  state.m4 = (m4[0] + m4[1]) + (m4[2] + m4[3]);
+  for (int64_t i = vector_length; i < length; ++i) {
+    const double d = values[i] - state.mean;
+    state.m2 += d * d;
+    if (kHigherMoments) {
+      state.m3 += d * d * d;
+      state.m4 += d * d * d * d;
+    }
+  }
+  return state;
+}
+
+template <typename ArrowType, MomentStatistic kStatistic>
+class MomentsAggregateFunction final : public AggregateFunctionStaticState<MomentsState> {
+ public:
+  explicit MomentsAggregateFunction(int ddof) : ddof_(ddof) {}
+
+  Status Consume(const Array& input, MomentsState* state) const override {
+    const auto& array = checked_cast<const NumericArray<ArrowType>&>(input);
+    const auto values = array.raw_values();
+    const int64_t length = array.length();
+
+    // Convert the valid values to doubles a block at a time
+    double block[kBlockSize];
+    int64_t block_length = 0;
+    auto append = [&](double value) {
+      block[block_length++] = value;
+      if (block_length == kBlockSize) {
+        MergeMoments<kHigherMoments>(BlockMoments<kHigherMoments>(block, block_length),
+                                     state);
+        block_length = 0;
+      }
+    };
+    if (array.null_count() == 0) {
+      for (int64_t i = 0; i < length; ++i) {
+        append(static_cast<double>(values[i]));
+      }
+    } else {
+      internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), length);
+      for (int64_t i = 0; i < length; ++i) {
+        if (reader.IsSet()) {
+          append(static_cast<double>(values[i]));
+        }
+        reader.Next();
+      }
+    }
+    if (block_length > 0) {
+      MergeMoments<kHigherMoments>(BlockMoments<kHigherMoments>(block, block_length),
+                                   state);
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const MomentsState& src, MomentsState* dst) const override {
+    MergeMoments<kHigherMoments>(src, dst);
+    return Status::OK();
+  }
+
+  Status Finalize(const MomentsState& src, Datum* output) const override {
+    const auto count = static_cast<double>(src.count);
+    double value;
+    switch (kStatistic) {
+      case MomentStatistic::VARIANCE:
+      case MomentStatistic::STDDEV:
+        if (src.count <= ddof_) {
+          *output = Datum(std::make_shared<DoubleScalar>());
+          return Status::OK();
+        }
+        value = src.m2 / (count - ddof_);
+        if (kStatistic == MomentStatistic::STDDEV) {
+          value = std::sqrt(value);
+        }
+        break;
+      case MomentStatistic::SKEW:
+      case MomentStatistic::KURTOSIS:
+        if (src.count == 0) {
+          *output = Datum(std::make_shared<DoubleScalar>());
+          return Status::OK();
+        }
+        if (kStatistic == MomentStatistic::SKEW) {
+          value = std::sqrt(count) * src.m3 / std::pow(src.m2, 1.5);
+        } else {
+          value = count * src.m4 / (src.m2 * src.m2) - 3;
+        }
+        break;
+    }
+    *output = Datum(std::make_shared<DoubleScalar>(value));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  static constexpr bool kHigherMoments = kStatistic == MomentStatistic::SKEW ||
+                                         kStatistic == MomentStatistic::KURTOSIS;
+  static constexpr int64_t kBlockSize = 1024;
+
+  int ddof_;
+};
+
+template <MomentStatistic kStatistic>
+struct MakeMomentsVisitor {
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value, Status>
+  Visit(const T&) {
+    out = std::make_shared<MomentsAggregateFunction<T, kStatistic>>(ddof);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  int ddof;
+  std::shared_ptr<AggregateFunction> out;
+};
+
+template <MomentStatistic kStatistic>
+static std::shared_ptr<AggregateFunction> MakeMomentsFunction(const DataType& type,
+                                                              int ddof = 0) {
+  if (ddof < 0) {
+    return nullptr;
+  }
+  MakeMomentsVisitor<kStatistic> visitor{ddof, nullptr};
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.out;
+}
+
+std::shared_ptr<AggregateFunction> MakeVarianceAggregateFunction(
+    const DataType& type, FunctionContext* context, const VarianceOptions& options) {
+  return MakeMomentsFunction<MomentStatistic::VARIANCE>(type, options.ddof);
+}
+
+std::shared_ptr<AggregateFunction> MakeStddevAggregateFunction(
+    const DataType& type, FunctionContext* context, const VarianceOptions& options) {
+  return MakeMomentsFunction<MomentStatistic::STDDEV>(type, options.ddof);
+}
+
+std::shared_ptr<AggregateFunction> MakeSkewAggregateFunction(const DataType& type,
+                                                             FunctionContext* context) {
+  return MakeMomentsFunction<MomentStatistic::SKEW>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeKurtosisAggregateFunction(
+    const DataType& type, FunctionContext* context) {
+  return MakeMomentsFunction<MomentStatistic::KURTOSIS>(type);
+}
+
+static Status CallMomentsFunction(FunctionContext* context, const char* name,
+                                  std::shared_ptr<AggregateFunction> aggregate,
+                                  const Datum& value, Datum* out) {
+  if (!aggregate) {
+    return Status::NotImplemented(name, " of type ", *value.type());
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(context, value, out);
+}
+
+static Status ValidateVariance(const char* name, const VarianceOptions& options,
+                               const Datum& value) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid(name, " is expecting an array-like datum.");
+  }
+  if (options.ddof < 0) {
+    return Status::Invalid(name, " ddof must not be negative, got ", options.ddof);
+  }
+  return Status::OK();
+}
+
+Status Variance(FunctionContext* context, const VarianceOptions& options,
+                const Datum& value, Datum* out) {
+  RETURN_NOT_OK(ValidateVariance("Variance", options, value));
+  return CallMomentsFunction(
+      context, "Variance", MakeVarianceAggregateFunction(*value.type(), context, options),
+      value, out);
+}
+
+Status Variance(FunctionContext* context, const VarianceOptions& options,
+                const Array& array, Datum* out) {
+  return Variance(context, options, array.data(), out);
+}
+
+Status Stddev(FunctionContext* context, const VarianceOptions& options,
+              const Datum& value, Datum* out) {
+  RETURN_NOT_OK(ValidateVariance("Stddev", options, value));
+  return CallMomentsFunction(
+      context, "Stddev", MakeStddevAggregateFunction(*value.type(), context, options),
+      value, out);
+}
+
+Status Stddev(FunctionContext* context, const VarianceOptions& options,
+              const Array& array, Datum* out) {
+  return Stddev(context, options, array.data(), out);
+}
+
+Status Skew(FunctionContext* context, const Datum& value, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Skew is expecting an array-like datum.");
+  }
+  return CallMomentsFunction(context, "Skew",
+                             MakeSkewAggregateFunction(*value.type(), context), value,
+                             out);
+}
+
+Status Skew(FunctionContext* context, const Array& array, Datum* out) {
+  return Skew(context, array.data(), out);
+}
+
+Status Kurtosis(FunctionContext* context, const Datum& value, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Kurtosis is expecting an array-like datum.");
+  }
+  return CallMomentsFunction(context, "Kurtosis",
+                             MakeKurtosisAggregateFunction(*value.type(), context), value,
+                             out);
+}
+
+Status Kurtosis(FunctionContext* context, const Array& array, Datum* out) {
+  return Kurtosis(context, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
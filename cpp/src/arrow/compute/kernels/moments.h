@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class VarianceOptions
+///
+/// The delta degrees of freedom of the variance: the sum of squared deviations
+/// from the mean is divided by the number of values minus ddof, e.g. 0 for the
+/// population variance and 1 for the sample variance.
+struct ARROW_EXPORT VarianceOptions {
+  explicit VarianceOptions(int ddof = 0) : ddof(ddof) {}
+
+  int ddof = 0;
+};
+
+/// \brief Return Variance function aggregate, or null if the type isn't
+/// supported
+///
+/// The state of the aggregate is the count, mean and sum of squared deviations
+/// of the values, merged with the parallel formula of Chan et al. so that
+/// states of different arrays, e.g. consumed by different threads, combine
+/// without loss of precision.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeVarianceAggregateFunction(
+    const DataType& type, FunctionContext* context, const VarianceOptions& options);
+
+/// \brief Return Stddev function aggregate, or null if the type isn't supported
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeStddevAggregateFunction(
+    const DataType& type, FunctionContext* context, const VarianceOptions& options);
+
+/// \brief Return Skew function aggregate, or null if the type isn't supported
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeSkewAggregateFunction(const DataType& type,
+                                                             FunctionContext* context);
+
+/// \brief Return Kurtosis function aggregate, or null if the type isn't
+/// supported
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeKurtosisAggregateFunction(
+    const DataType& type, FunctionContext* context);
+
+/// \brief Compute the variance of a numeric array.
+///
+/// Nulls are ignored. The variance is null if there are no more values than
+/// options.ddof.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] value datum to compute the variance, expecting Array or
+///            ChunkedArray
+/// \param[out] out datum of the computed variance as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Variance(FunctionContext* context, const VarianceOptions& options,
+                const Datum& value, Datum* out);
+
+/// \brief Compute the variance of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] array to compute the variance
+/// \param[out] out datum of the computed variance as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Variance(FunctionContext* context, const VarianceOptions& options,
+                const Array& array, Datum* out);
+
+/// \brief Compute the standard deviation of a numeric array.
+///
+/// The square root of the variance, see Variance.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] value datum to compute the standard deviation, expecting Array or
+///            ChunkedArray
+/// \param[out] out datum of the computed standard deviation as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Stddev(FunctionContext* context, const VarianceOptions& options,
+              const Datum& value, Datum* out);
+
+/// \brief Compute the standard deviation of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] array to compute the standard deviation
+/// \param[out] out datum of the computed standard deviation as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Stddev(FunctionContext* context, const VarianceOptions& options,
+              const Array& array, Datum* out);
+
+/// \brief Compute the skewness of a numeric array.
+///
+/// The population skewness m3 / m2^1.5, where mk is the mean of the k-th power
+/// of the deviations from the mean. Nulls are ignored. The skewness is null if
+/// there are no values, and NaN if all the values are equal.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to compute the skewness, expecting Array or
+///            ChunkedArray
+/// \param[out] out datum of the computed skewness as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Skew(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the skewness of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to compute the skewness
+/// \param[out] out datum of the computed skewness as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Skew(FunctionContext* context, const Array& array, Datum* out);
+
+/// \brief Compute the excess kurtosis of a numeric array.
+///
+/// The population excess kurtosis m4 / m2^2 - 3, where mk is the mean of the
+/// k-th power of the deviations from the mean. Nulls are ignored. The kurtosis
+/// is null if there are no values, and NaN if all the values are equal.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to compute the kurtosis, expecting Array or
+///            ChunkedArray
+/// \param[out] out datum of the computed kurtosis as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Kurtosis(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the excess kurtosis of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to compute the kurtosis
+/// \param[out] out datum of the computed kurtosis as a DoubleScalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Kurtosis(FunctionContext* context, const Array& array, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,389 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/quantile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+static Status ValidateQuantiles(const char* name, const std::vector<double>& q) {
+  for (double quantile : q) {
+    if (!(quantile >= 0 && quantile <= 1)) {
+      return Status::Invalid(name, " quantiles must be between 0 and 1, got ", quantile);
+    }
+  }
+  return Status::OK();
+}
+
+// Visit the non-null, non-NaN values of a numeric array as doubles
+template <typename ArrowType, typename Visitor>
+static void VisitValues(const Array& input, Visitor&& visit) {
+  using c_type = typename ArrowType::c_type;
+  VisitArrayDataInline<ArrowType>(*input.data(), [&](util::optional<c_type> value) {
+    if (value.has_value()) {
+      const auto v = static_cast<double>(*value);
+      if (!std::isnan(v)) {
+        visit(v);
+      }
+    }
+  });
+}
+
+// A DoubleArray of quantiles, all null if there were no values
+template <typename GetQuantile>
+static Status FinishQuantiles(MemoryPool* pool, const std::vector<double>& q, bool empty,
+                              GetQuantile&& get_quantile, Datum* output) {
+  DoubleBuilder builder(pool);
+  RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(q.size())));
+  for (double quantile : q) {
+    if (empty) {
+      builder.UnsafeAppendNull();
+    } else {
+      builder.UnsafeAppend(get_quantile(quantile));
+    }
+  }
+  std::shared_ptr<Array> quantiles;
+  RETURN_NOT_OK(builder.Finish(&quantiles));
+  *output = Datum(quantiles);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Exact quantiles
+
+struct QuantileState {
+  std::vector<double> values;
+};
+
+template <typename ArrowType>
+class QuantileAggregateFunction final
+    : public AggregateFunctionStaticState<QuantileState> {
+ public:
+  QuantileAggregateFunction(MemoryPool* pool, std::vector<double> q)
+      : pool_(pool), q_(std::move(q)) {}
+
+  Status Consume(const Array& input, QuantileState* state) const override {
+    state->values.reserve(state->values.size() +
+                          static_cast<size_t>(input.length() - input.null_count()));
+    VisitValues<ArrowType>(input, [&](double v) { state->values.push_back(v); });
+    return Status::OK();
+  }
+
+  Status Merge(const QuantileState& src, QuantileState* dst) const override {
+    dst->values.insert(dst->values.end(), src.values.begin(), src.values.end());
+    return Status::OK();
+  }
+
+  Status Finalize(const QuantileState& src, Datum* output) const override {
+    std::vector<double> values = src.values;
+    const auto last = static_cast<double>(values.size()) - 1;
+    return FinishQuantiles(
+        pool_, q_, values.empty(),
+        [&](double quantile) {
+          // Interpolate between the values ranking just below and above
+          const double rank = quantile * last;
+          const auto lower = static_cast<size_t>(std::floor(rank));
+          std::nth_element(values.begin(), values.begin() + lower, values.end());
+          const double lower_value = values[lower];
+          if (rank == static_cast<double>(lower)) {
+            return lower_value;
+          }
+          const double upper_value =
+              *std::min_element(values.begin() + lower + 1, values.end());
+          return lower_value + (rank - static_cast<double>(lower)) *
+                                   (upper_value - lower_value);
+        },
+        output);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  MemoryPool* pool_;
+  std::vector<double> q_;
+};
+
+// ----------------------------------------------------------------------
+// Approximate quantiles
+//
+// A merging t-digest (Dunning & Ertl, "Computing Extremely Accurate Quantiles
+// Using t-Digests") summarizes values as centroids, i.e. the mean and the
+// count of some adjacent values. Centroids of values with quantiles close to 0
+// or 1 are kept small, so tail quantiles are estimated most accurately.
+
+struct Centroid {
+  double mean;
+  double weight;
+};
+
+// The centroids of the digest in increasing order of mean, and the values and
+// centroids not yet merged into them
+struct TDigestState {
+  std::vector<Centroid> centroids;
+  std::vector<Centroid> buffer;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+};
+
+class TDigestImpl {
+ public:
+  TDigestImpl(uint32_t delta, uint32_t buffer_size)
+      : delta_(delta), buffer_size_(buffer_size) {}
+
+  void Add(double value, TDigestState* state) const {
+    state->buffer.push_back({value, 1});
+    state->min = std::min(state->min, value);
+    state->max = std::max(state->max, value);
+    if (state->buffer.size() >= buffer_size_) {
+      Compress(state);
+    }
+  }
+
+  void Merge(const TDigestState& src, TDigestState* dst) const {
+    dst->buffer.insert(dst->buffer.end(), src.centroids.begin(), src.centroids.end());
+    dst->buffer.insert(dst->buffer.end(), src.buffer.begin(), src.buffer.end());
+    dst->min = std::min(dst->min, src.min);
+    dst->max = std::max(dst->max, src.max);
+    if (dst->buffer.size() >= buffer_size_) {
+      Compress(dst);
+    }
+  }
+
+  // Merge the buffer into the centroids, joining adjacent centroids as long as
+  // the joined centroid spans at most one unit of the scale function
+  void Compress(TDigestState* state) const {
+    auto& points = state->buffer;
+    if (points.empty()) {
+      return;
+    }
+    points.insert(points.end(), state->centroids.begin(), state->centroids.end());
+    std::sort(points.begin(), points.end(),
+              [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+    double total = 0;
+    for (const Centroid& point : points) {
+      total += point.weight;
+    }
+
+    auto& centroids = state->centroids;
+    centroids.clear();
+    Centroid current = points[0];
+    double weight_so_far = current.weight;
+    double weight_limit = total * WeightLimit(0);
+    for (size_t i = 1; i < points.size(); ++i) {
+      const Centroid& point = points[i];
+      if (weight_so_far + point.weight <= weight_limit) {
+        current.weight += point.weight;
+        current.mean += (point.mean - current.mean) * point.weight / current.weight;
+      } else {
+        centroids.push_back(current);
+        weight_limit = total * WeightLimit(weight_so_far / total);
+        current = point;
+      }
+      weight_so_far += point.weight;
+    }
+    centroids.push_back(current);
+    points.clear();
+  }
+
+  // Interpolate between the means of the centroids around the quantile, taking
+  // each centroid's mean to sit in the middle of its values
+  double Quantile(const TDigestState& state, double quantile) const {
+    const auto& centroids = state.centroids;
+    DCHECK(!centroids.empty());
+    double total = 0;
+    for (const Centroid& centroid : centroids) {
+      total += centroid.weight;
+    }
+    const double target = quantile * total;
+
+    double left = 0, left_value = state.min;
+    double cumulative = 0;
+    for (const Centroid& centroid : centroids) {
+      const double middle = cumulative + centroid.weight / 2;
+      if (target < middle) {
+        return Interpolate(target, left, left_value, middle, centroid.mean);
+      }
+      left = middle;
+      left_value = centroid.mean;
+      cumulative += centroid.weight;
+    }
+    return Interpolate(target, left, left_value, total, state.max);
+  }
+
+ private:
+  // The quantile one unit after q of the k1 scale function of the paper,
+  // k(q) = delta / (2 pi) * asin(2q - 1), which ranges over [-delta/4, delta/4]
+  double WeightLimit(double q) const {
+    constexpr double kTwoPi = 6.283185307179586;
+    const double k = delta_ / kTwoPi * std::asin(2 * q - 1) + 1;
+    if (k >= delta_ / 4) {
+      return 1;
+    }
+    return (std::sin(k * kTwoPi / delta_) + 1) / 2;
+  }
+
+  static double Interpolate(double x, double x0, double y0, double x1, double y1) {
+    if (x1 <= x0) {
+      return y1;
+    }
+    return y0 + (x - x0) / (x1 - x0) * (y1 - y0);
+  }
+
+  double delta_;
+  size_t buffer_size_;
+};
+
+template <typename ArrowType>
+class TDigestAggregateFunction final : public AggregateFunctionStaticState<TDigestState> {
+ public:
+  TDigestAggregateFunction(MemoryPool* pool, const TDigestOptions& options)
+      : pool_(pool), q_(options.q), digest_(options.delta, options.buffer_size) {}
+
+  Status Consume(const Array& input, TDigestState* state) const override {
+    VisitValues<ArrowType>(input, [&](double v) { digest_.Add(v, state); });
+    return Status::OK();
+  }
+
+  Status Merge(const TDigestState& src, TDigestState* dst) const override {
+    digest_.Merge(src, dst);
+    return Status::OK();
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const override {
+    TDigestState state = src;
+    digest_.Compress(&state);
+    return FinishQuantiles(
+        pool_, q_, state.centroids.empty(),
+        [&](double quantile) {
+          return std::min(state.max,
+                          std::max(state.min, digest_.Quantile(state, quantile)));
+        },
+        output);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  MemoryPool* pool_;
+  std::vector<double> q_;
+  TDigestImpl digest_;
+};
+
+// ----------------------------------------------------------------------
+
+template <template <typename> class AggregateFunctionType, typename Options>
+struct MakeQuantileVisitor {
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || is_physical_floating_type<T>::value, Status>
+  Visit(const T&) {
+    out = std::make_shared<AggregateFunctionType<T>>(pool, options);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  MemoryPool* pool;
+  const Options& options;
+  std::shared_ptr<AggregateFunction> out;
+};
+
+template <template <typename> class AggregateFunctionType, typename Options>
+static std::shared_ptr<AggregateFunction> MakeQuantileFunction(const DataType& type,
+                                                               FunctionContext* context,
+                                                               const Options& options) {
+  MemoryPool* pool = context ? context->memory_pool() : default_memory_pool();
+  MakeQuantileVisitor<AggregateFunctionType, Options> visitor{pool, options, nullptr};
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.out;
+}
+
+std::shared_ptr<AggregateFunction> MakeQuantileAggregateFunction(
+    const DataType& type, FunctionContext* context, const QuantileOptions& options) {
+  if (!ValidateQuantiles("Quantile", options.q).ok()) {
+    return nullptr;
+  }
+  return MakeQuantileFunction<QuantileAggregateFunction>(type, context, options.q);
+}
+
+std::shared_ptr<AggregateFunction> MakeTDigestAggregateFunction(
+    const DataType& type, FunctionContext* context, const TDigestOptions& options) {
+  if (!ValidateQuantiles("TDigest", options.q).ok() || options.delta == 0 ||
+      options.buffer_size == 0) {
+    return nullptr;
+  }
+  return MakeQuantileFunction<TDigestAggregateFunction>(type, context, options);
+}
+
+static Status CallQuantileFunction(FunctionContext* context, const char* name,
+                                   std::shared_ptr<AggregateFunction> aggregate,
+                                   const Datum& value, Datum* out) {
+  if (!aggregate) {
+    return Status::NotImplemented(name, " of type ", *value.type());
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(context, value, out);
+}
+
+Status Quantile(FunctionContext* context, const QuantileOptions& options,
+                const Datum& value, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Quantile is expecting an array-like datum.");
+  }
+  RETURN_NOT_OK(ValidateQuantiles("Quantile", options.q));
+  return CallQuantileFunction(
+      context, "Quantile",
+      MakeQuantileAggregateFunction(*value.type(), context, options), value, out);
+}
+
+Status Quantile(FunctionContext* context, const QuantileOptions& options,
+                const Array& array, Datum* out) {
+  return Quantile(context, options, array.data(), out);
+}
+
+Status TDigest(FunctionContext* context, const TDigestOptions& options,
+               const Datum& value, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("TDigest is expecting an array-like datum.");
+  }
+  RETURN_NOT_OK(ValidateQuantiles("TDigest", options.q));
+  if (options.delta == 0 || options.buffer_size == 0) {
+    return Status::Invalid("TDigest delta and buffer size must be positive");
+  }
+  return CallQuantileFunction(
+      context, "TDigest", MakeTDigestAggregateFunction(*value.type(), context, options),
+      value, out);
+}
+
+Status TDigest(FunctionContext* context, const TDigestOptions& options,
+               const Array& array, Datum* out) {
+  return TDigest(context, options, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class QuantileOptions
+///
+/// The quantiles to compute, each between 0 and 1.
+struct ARROW_EXPORT QuantileOptions {
+  explicit QuantileOptions(std::vector<double> q = {0.5}) : q(std::move(q)) {}
+
+  std::vector<double> q;
+};
+
+/// \class TDigestOptions
+///
+/// The quantiles to estimate, each between 0 and 1, and the size of the
+/// t-digest estimating them: it keeps at most about delta centroids, and
+/// buffers up to buffer_size values before merging them into the centroids.
+/// Larger values of delta make the estimates more accurate.
+struct ARROW_EXPORT TDigestOptions {
+  explicit TDigestOptions(std::vector<double> q = {0.5}, uint32_t delta = 100,
+                          uint32_t buffer_size = 500)
+      : q(std::move(q)), delta(delta), buffer_size(buffer_size) {}
+
+  std::vector<double> q;
+  uint32_t delta;
+  uint32_t buffer_size;
+};
+
+/// \brief Return Quantile function aggregate, or null if the type isn't
+/// supported
+///
+/// The state of the aggregate holds every value consumed, so it only suits
+/// data fitting in memory.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeQuantileAggregateFunction(
+    const DataType& type, FunctionContext* context, const QuantileOptions& options);
+
+/// \brief Compute quantiles of a numeric array.
+///
+/// Quantiles falling between two values are linearly interpolated. Nulls and
+/// NaNs are ignored; all the quantiles are null if no value is left.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles to compute
+/// \param[in] value datum to compute quantiles of, expecting Array or ChunkedArray
+/// \param[out] out datum of a DoubleArray of the quantiles, in the order of
+///             options.q
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Quantile(FunctionContext* context, const QuantileOptions& options,
+                const Datum& value, Datum* out);
+
+/// \brief Compute quantiles of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles to compute
+/// \param[in] array to compute quantiles of
+/// \param[out] out datum of a DoubleArray of the quantiles, in the order of
+///             options.q
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Quantile(FunctionContext* context, const QuantileOptions& options,
+                const Array& array, Datum* out);
+
+/// \brief Return TDigest function aggregate, or null if the type or the
+/// options aren't supported
+///
+/// The state of the aggregate is a t-digest of bounded size, so merging the
+/// states of several arrays, e.g. consumed by different threads, estimates the
+/// quantiles of all of them.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeTDigestAggregateFunction(
+    const DataType& type, FunctionContext* context, const TDigestOptions& options);
+
+/// \brief Estimate quantiles of a numeric array with a t-digest.
+///
+/// Estimates are most accurate for quantiles close to 0 and 1, e.g. p99.
+/// Nulls and NaNs are ignored; all the quantiles are null if no value is left.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles to estimate and the size of the digest
+/// \param[in] value datum to estimate quantiles of, expecting Array or
+///            ChunkedArray
+/// \param[out] out datum of a DoubleArray of the estimates, in the order of
+///             options.q
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TDigest(FunctionContext* context, const TDigestOptions& options,
+               const Datum& value, Datum* out);
+
+/// \brief Estimate quantiles of a numeric array with a t-digest.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles to estimate and the size of the digest
+/// \param[in] array to estimate quantiles of
+/// \param[out] out datum of a DoubleArray of the estimates, in the order of
+///             options.q
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TDigest(FunctionContext* context, const TDigestOptions& options,
+               const Array& array, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
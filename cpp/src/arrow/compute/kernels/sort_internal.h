@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+namespace detail {
+
+/// \brief Compares values of a column, possibly held by different arrays,
+/// in the order given by a sort key
+class ARROW_EXPORT ColumnComparator {
+ public:
+  virtual ~ColumnComparator() = default;
+
+  /// \brief Three-way comparison of left[left_index] and right[right_index]:
+  /// negative if the left value sorts first, positive if the right one does
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+
+  /// \brief factory for ColumnComparators
+  ///
+  /// \param[in] type the type of the compared arrays
+  /// \param[in] key the sort order and null placement, the key name is ignored
+  /// \param[out] out created ColumnComparator
+  static Status Make(const std::shared_ptr<DataType>& type, const SortKey& key,
+                     std::unique_ptr<ColumnComparator>* out);
+};
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -18,22 +18,34 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
 #include <limits>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/sort_internal.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 class Array;
 
+using internal::checked_cast;
+
 namespace compute {
 
 /// \brief UnaryKernel implementing SortToIndices operation
@@ -316,5 +328,563 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Multi-column sorting
+
+namespace {
+
+// Sorts ranges of row indices by the values of a single column.
+//
+// Rows are sorted by several columns without ever comparing whole rows: the
+// indices are sorted by the first column, then each run of rows holding equal
+// values of it is sorted by the second column, and so on.
+class ColumnSorter {
+ public:
+  virtual ~ColumnSorter() = default;
+
+  // Stably sort the row indices in [begin, end) by this column
+  virtual void Sort(int64_t* begin, int64_t* end) = 0;
+
+  // Call visit(run_begin, run_end) for each run of two or more rows of
+  // [begin, end), already sorted by this column, holding equal values
+  virtual void VisitTies(int64_t* begin, int64_t* end,
+                         const std::function<void(int64_t*, int64_t*)>& visit) = 0;
+};
+
+// NaNs sort after all other values, whatever the order, and compare equal to
+// each other
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsNaN(T value) {
+  return std::isnan(value);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_floating_point<T>::value, bool>::type IsNaN(
+    const T&) {
+  return false;
+}
+
+// Three-way comparison of two non-null values in the given order
+template <typename T>
+int CompareValues(const T& left, const T& right, bool descending) {
+  const bool left_nan = IsNaN(left);
+  const bool right_nan = IsNaN(right);
+  if (left_nan || right_nan) {
+    return left_nan == right_nan ? 0 : (left_nan ? 1 : -1);
+  }
+  const int result = left < right ? -1 : (right < left ? 1 : 0);
+  return descending ? -result : result;
+}
+
+template <typename ArrowType, typename Enable = void>
+struct IsRadixSortable : std::false_type {};
+
+template <typename ArrowType>
+struct IsRadixSortable<ArrowType, typename std::enable_if<std::is_integral<
+                                      typename ArrowType::c_type>::value>::type>
+    : std::true_type {};
+
+template <typename ArrowType>
+class TypedColumnSorter : public ColumnSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  TypedColumnSorter(const std::shared_ptr<Array>& values, const SortKey& key)
+      : values_(checked_cast<const ArrayType&>(*values)),
+        owned_values_(values),
+        descending_(key.order == SortKey::DESCENDING),
+        nulls_first_(key.null_placement == SortKey::NULLS_FIRST) {}
+
+  void Sort(int64_t* begin, int64_t* end) override {
+    int64_t* values_begin = begin;
+    int64_t* values_end = end;
+    if (values_.null_count() > 0) {
+      if (nulls_first_) {
+        values_begin = std::stable_partition(
+            begin, end, [this](int64_t i) { return values_.IsNull(i); });
+      } else {
+        values_end = std::stable_partition(
+            begin, end, [this](int64_t i) { return values_.IsValid(i); });
+      }
+    }
+    if (is_floating_type<ArrowType>::value) {
+      values_end = std::stable_partition(values_begin, values_end, [this](int64_t i) {
+        return !IsNaN(values_.GetView(i));
+      });
+    }
+    SortValues(values_begin, values_end, IsRadixSortable<ArrowType>());
+  }
+
+  void VisitTies(int64_t* begin, int64_t* end,
+                 const std::function<void(int64_t*, int64_t*)>& visit) override {
+    if (begin == end) {
+      return;
+    }
+    int64_t* run_begin = begin;
+    for (int64_t* it = begin + 1; it != end; ++it) {
+      if (!Equals(*run_begin, *it)) {
+        if (it - run_begin > 1) {
+          visit(run_begin, it);
+        }
+        run_begin = it;
+      }
+    }
+    if (end - run_begin > 1) {
+      visit(run_begin, end);
+    }
+  }
+
+ private:
+  bool Equals(int64_t left, int64_t right) const {
+    const bool left_null = values_.IsNull(left);
+    const bool right_null = values_.IsNull(right);
+    if (left_null || right_null) {
+      return left_null && right_null;
+    }
+    const auto left_value = values_.GetView(left);
+    const auto right_value = values_.GetView(right);
+    if (IsNaN(left_value) || IsNaN(right_value)) {
+      return IsNaN(left_value) && IsNaN(right_value);
+    }
+    return left_value == right_value;
+  }
+
+  void CompareSort(int64_t* begin, int64_t* end) {
+    if (descending_) {
+      std::stable_sort(begin, end, [this](int64_t left, int64_t right) {
+        return values_.GetView(right) < values_.GetView(left);
+      });
+    } else {
+      std::stable_sort(begin, end, [this](int64_t left, int64_t right) {
+        return values_.GetView(left) < values_.GetView(right);
+      });
+    }
+  }
+
+  void SortValues(int64_t* begin, int64_t* end, std::false_type) {
+    CompareSort(begin, end);
+  }
+
+  void SortValues(int64_t* begin, int64_t* end, std::true_type) {
+    if (end - begin < kRadixSortMinLength) {
+      CompareSort(begin, end);
+    } else {
+      RadixSort(begin, end);
+    }
+  }
+
+  // LSD radix sort, one byte at a time.  Values are mapped to unsigned keys
+  // ordering the same way (the sign bit flipped, all bits flipped when
+  // descending) so that each pass is a stable counting sort on a byte.
+  void RadixSort(int64_t* begin, int64_t* end) {
+    using c_type = typename ArrowType::c_type;
+    using Unsigned = typename std::make_unsigned<c_type>::type;
+    constexpr int kNumBits = static_cast<int>(sizeof(c_type) * 8);
+
+    const Unsigned sign_flip = std::is_signed<c_type>::value
+                                   ? static_cast<Unsigned>(Unsigned(1) << (kNumBits - 1))
+                                   : Unsigned(0);
+    const Unsigned mask =
+        sign_flip ^ (descending_ ? static_cast<Unsigned>(~Unsigned(0)) : Unsigned(0));
+    const c_type* raw_values = values_.raw_values();
+
+    const int64_t length = end - begin;
+    scratch_.resize(length);
+    int64_t* src = begin;
+    int64_t* dst = scratch_.data();
+    for (int shift = 0; shift < kNumBits; shift += 8) {
+      std::array<int64_t, 257> counts{};
+      for (int64_t i = 0; i < length; i++) {
+        const Unsigned key = static_cast<Unsigned>(raw_values[src[i]]) ^ mask;
+        ++counts[((key >> shift) & 0xff) + 1];
+      }
+      // Nothing to do if all keys share this byte
+      if (std::find(counts.begin(), counts.end(), length) != counts.end()) {
+        continue;
+      }
+      std::partial_sum(counts.begin(), counts.end(), counts.begin());
+      for (int64_t i = 0; i < length; i++) {
+        const Unsigned key = static_cast<Unsigned>(raw_values[src[i]]) ^ mask;
+        dst[counts[(key >> shift) & 0xff]++] = src[i];
+      }
+      std::swap(src, dst);
+    }
+    if (src != begin) {
+      std::copy(src, src + length, begin);
+    }
+  }
+
+  // Below this length std::stable_sort beats the radix passes
+  static constexpr int64_t kRadixSortMinLength = 1024;
+
+  const ArrayType& values_;
+  std::shared_ptr<Array> owned_values_;
+  const bool descending_;
+  const bool nulls_first_;
+  std::vector<int64_t> scratch_;
+};
+
+template <typename ArrowType>
+constexpr int64_t TypedColumnSorter<ArrowType>::kRadixSortMinLength;
+
+#define PROCESS_SORT_KEY_TYPES(PROCESS) \
+  PROCESS(UInt8Type)                    \
+  PROCESS(Int8Type)                     \
+  PROCESS(UInt16Type)                   \
+  PROCESS(Int16Type)                    \
+  PROCESS(UInt32Type)                   \
+  PROCESS(Int32Type)                    \
+  PROCESS(UInt64Type)                   \
+  PROCESS(Int64Type)                    \
+  PROCESS(FloatType)                    \
+  PROCESS(DoubleType)                   \
+  PROCESS(Date32Type)                   \
+  PROCESS(Date64Type)                   \
+  PROCESS(Time32Type)                   \
+  PROCESS(Time64Type)                   \
+  PROCESS(TimestampType)                \
+  PROCESS(BinaryType)                   \
+  PROCESS(StringType)
+
+Status MakeColumnSorter(const std::shared_ptr<Array>& values, const SortKey& key,
+                        std::unique_ptr<ColumnSorter>* out) {
+  switch (values->type_id()) {
+#define PROCESS(InType)                                     \
+  case InType::type_id:                                     \
+    out->reset(new TypedColumnSorter<InType>(values, key)); \
+    return Status::OK();
+
+    PROCESS_SORT_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *values->type(), " arrays");
+}
+
+void SortRange(const std::vector<std::unique_ptr<ColumnSorter>>& sorters, size_t key,
+               int64_t* begin, int64_t* end) {
+  sorters[key]->Sort(begin, end);
+  if (key + 1 < sorters.size()) {
+    sorters[key]->VisitTies(begin, end, [&](int64_t* run_begin, int64_t* run_end) {
+      SortRange(sorters, key + 1, run_begin, run_end);
+    });
+  }
+}
+
+// Sort length rows by the given key columns, one per sort key
+Status SortColumnsToIndices(FunctionContext* ctx,
+                            const std::vector<std::shared_ptr<Array>>& columns,
+                            const std::vector<SortKey>& keys, int64_t length,
+                            std::shared_ptr<Array>* offsets) {
+  std::vector<std::unique_ptr<ColumnSorter>> sorters(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    RETURN_NOT_OK(MakeColumnSorter(columns[i], keys[i], &sorters[i]));
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  int64_t* indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  int64_t* indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+  SortRange(sorters, 0, indices_begin, indices_end);
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Sorting of chunked inputs
+//
+// Each chunk is sorted on its own, possibly in parallel, then the sorted
+// chunks are merged with a heap.
+
+template <typename ArrowType>
+class TypedColumnComparator : public detail::ColumnComparator {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  explicit TypedColumnComparator(const SortKey& key)
+      : descending_(key.order == SortKey::DESCENDING),
+        nulls_first_(key.null_placement == SortKey::NULLS_FIRST) {}
+
+  int Compare(const Array& left, int64_t left_index, const Array& right,
+              int64_t right_index) const override {
+    const auto& left_values = checked_cast<const ArrayType&>(left);
+    const auto& right_values = checked_cast<const ArrayType&>(right);
+    const bool left_null = left_values.IsNull(left_index);
+    const bool right_null = right_values.IsNull(right_index);
+    if (left_null || right_null) {
+      if (left_null && right_null) {
+        return 0;
+      }
+      return left_null == nulls_first_ ? -1 : 1;
+    }
+    return CompareValues(left_values.GetView(left_index),
+                         right_values.GetView(right_index), descending_);
+  }
+
+ private:
+  const bool descending_;
+  const bool nulls_first_;
+};
+
+}  // namespace
+
+Status detail::ColumnComparator::Make(const std::shared_ptr<DataType>& type,
+                                      const SortKey& key,
+                                      std::unique_ptr<ColumnComparator>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                  \
+  case InType::type_id:                                  \
+    out->reset(new TypedColumnComparator<InType>(key)); \
+    return Status::OK();
+
+    PROCESS_SORT_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *type, " arrays");
+}
+
+#undef PROCESS_SORT_KEY_TYPES
+
+namespace {
+
+// A slice of the input, with the key columns it holds and, once sorted, the
+// indices that sort it
+struct SortChunk {
+  std::vector<std::shared_ptr<Array>> columns;
+  int64_t length;
+  std::shared_ptr<Array> indices;
+};
+
+// Sort the chunks, then call emit(chunk_id, index_in_chunk) for each row in
+// sorted order.  Rows comparing equal are emitted in input order.
+template <typename Emit>
+Status SortChunks(FunctionContext* ctx,
+                  const std::vector<std::shared_ptr<DataType>>& types,
+                  const std::vector<SortKey>& keys, bool use_threads,
+                  std::vector<SortChunk>* chunks, Emit&& emit) {
+  std::vector<std::unique_ptr<detail::ColumnComparator>> comparators(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    RETURN_NOT_OK(detail::ColumnComparator::Make(types[i], keys[i], &comparators[i]));
+  }
+
+  auto task_group = use_threads && chunks->size() > 1
+                        ? internal::TaskGroup::MakeThreaded(internal::GetCpuThreadPool())
+                        : internal::TaskGroup::MakeSerial();
+  for (auto& chunk : *chunks) {
+    SortChunk* chunk_ptr = &chunk;
+    task_group->Append([ctx, chunk_ptr, &keys] {
+      return SortColumnsToIndices(ctx, chunk_ptr->columns, keys, chunk_ptr->length,
+                                  &chunk_ptr->indices);
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  // k-way merge of the sorted chunks
+  struct Cursor {
+    int32_t chunk_id;
+    int64_t position;
+    uint64_t index;
+  };
+  std::vector<const uint64_t*> chunk_indices;
+  for (const auto& chunk : *chunks) {
+    const auto& indices = checked_cast<const UInt64Array&>(*chunk.indices);
+    chunk_indices.push_back(indices.raw_values());
+  }
+  // Whether a is to be emitted after b
+  auto after = [&](const Cursor& a, const Cursor& b) {
+    for (size_t i = 0; i < comparators.size(); i++) {
+      const int result =
+          comparators[i]->Compare(*(*chunks)[a.chunk_id].columns[i], a.index,
+                                  *(*chunks)[b.chunk_id].columns[i], b.index);
+      if (result != 0) {
+        return result > 0;
+      }
+    }
+    return a.chunk_id > b.chunk_id;
+  };
+  std::vector<Cursor> heap;
+  for (int32_t chunk_id = 0; chunk_id < static_cast<int32_t>(chunks->size());
+       chunk_id++) {
+    if ((*chunks)[chunk_id].length > 0) {
+      heap.push_back({chunk_id, 0, chunk_indices[chunk_id][0]});
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), after);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), after);
+    Cursor& cursor = heap.back();
+    emit(cursor.chunk_id, cursor.index);
+    if (++cursor.position < (*chunks)[cursor.chunk_id].length) {
+      cursor.index = chunk_indices[cursor.chunk_id][cursor.position];
+      std::push_heap(heap.begin(), heap.end(), after);
+    } else {
+      heap.pop_back();
+    }
+  }
+  return Status::OK();
+}
+
+// Sort chunks into logical row indices of the whole input
+Status SortChunksToIndices(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<DataType>>& types,
+                           const std::vector<SortKey>& keys, bool use_threads,
+                           std::vector<SortChunk>* chunks,
+                           std::shared_ptr<Array>* offsets) {
+  if (chunks->size() == 1) {
+    auto& chunk = (*chunks)[0];
+    return SortColumnsToIndices(ctx, chunk.columns, keys, chunk.length, offsets);
+  }
+
+  std::vector<int64_t> chunk_offsets;
+  int64_t length = 0;
+  for (const auto& chunk : *chunks) {
+    chunk_offsets.push_back(length);
+    length += chunk.length;
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  uint64_t* out = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  RETURN_NOT_OK(SortChunks(ctx, types, keys, use_threads, chunks,
+                           [&](int32_t chunk_id, uint64_t index) {
+                             *out++ = chunk_offsets[chunk_id] + index;
+                           }));
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+Status MakeChunkedArrayChunks(const ChunkedArray& values,
+                              std::vector<SortChunk>* chunks) {
+  for (const auto& chunk : values.chunks()) {
+    if (chunk->length() > 0) {
+      chunks->push_back({{chunk}, chunk->length(), nullptr});
+    }
+  }
+  if (chunks->empty()) {
+    std::shared_ptr<Array> empty;
+    RETURN_NOT_OK(MakeArrayOfNull(values.type(), 0, &empty));
+    chunks->push_back({{empty}, 0, nullptr});
+  }
+  return Status::OK();
+}
+
+Status FindSortColumn(const Schema& schema, const SortKey& key, int* out) {
+  *out = schema.GetFieldIndex(key.name);
+  if (*out < 0) {
+    return Status::Invalid("No unique column named '", key.name, "' in schema ", schema);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& key : keys) {
+    int index;
+    RETURN_NOT_OK(FindSortColumn(*batch.schema(), key, &index));
+    columns.push_back(batch.column(index));
+  }
+  return SortColumnsToIndices(ctx, columns, keys, batch.num_rows(), offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<SortChunk> chunks;
+  RETURN_NOT_OK(MakeChunkedArrayChunks(values, &chunks));
+  return SortChunksToIndices(ctx, {values.type()}, {SortKey("")}, options.use_threads,
+                             &chunks, offsets);
+}
+
+Status SortToChunkedIndices(FunctionContext* ctx, const ChunkedArray& values,
+                            const SortOptions& options,
+                            std::shared_ptr<Array>* chunk_ids,
+                            std::shared_ptr<Array>* chunk_offsets) {
+  // Empty chunks are skipped, map our chunk ids back to those of values
+  std::vector<int32_t> value_chunk_ids;
+  for (int i = 0; i < values.num_chunks(); i++) {
+    if (values.chunk(i)->length() > 0) {
+      value_chunk_ids.push_back(i);
+    }
+  }
+  std::vector<SortChunk> chunks;
+  RETURN_NOT_OK(MakeChunkedArrayChunks(values, &chunks));
+
+  const int64_t length = values.length();
+  std::shared_ptr<Buffer> ids_buf, offsets_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(int32_t), &ids_buf));
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &offsets_buf));
+  int32_t* ids_out = reinterpret_cast<int32_t*>(ids_buf->mutable_data());
+  uint64_t* offsets_out = reinterpret_cast<uint64_t*>(offsets_buf->mutable_data());
+  RETURN_NOT_OK(SortChunks(ctx, {values.type()}, {SortKey("")}, options.use_threads,
+                           &chunks, [&](int32_t chunk_id, uint64_t index) {
+                             *ids_out++ = value_chunk_ids[chunk_id];
+                             *offsets_out++ = index;
+                           }));
+  *chunk_ids = std::make_shared<Int32Array>(length, ids_buf);
+  *chunk_offsets = std::make_shared<UInt64Array>(length, offsets_buf);
+  return Status::OK();
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  std::vector<std::shared_ptr<Field>> key_fields;
+  std::vector<std::shared_ptr<ChunkedArray>> key_columns;
+  std::vector<std::shared_ptr<DataType>> key_types;
+  for (const auto& key : keys) {
+    int index;
+    RETURN_NOT_OK(FindSortColumn(*table.schema(), key, &index));
+    key_fields.push_back(table.schema()->field(index));
+    key_columns.push_back(table.column(index));
+    key_types.push_back(table.schema()->field(index)->type());
+  }
+
+  // Slice the key columns, whose chunk layouts may differ, into aligned
+  // chunks without copying
+  auto key_table = Table::Make(schema(key_fields), key_columns, table.num_rows());
+  TableBatchReader reader(*key_table);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  std::vector<SortChunk> chunks;
+  for (const auto& batch : batches) {
+    if (batch->num_rows() > 0) {
+      chunks.push_back({batch->columns(), batch->num_rows(), nullptr});
+    }
+  }
+  if (chunks.empty()) {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const auto& type : key_types) {
+      std::shared_ptr<Array> empty;
+      RETURN_NOT_OK(MakeArrayOfNull(type, 0, &empty));
+      columns.push_back(std::move(empty));
+    }
+    chunks.push_back({std::move(columns), 0, nullptr});
+  }
+  return SortChunksToIndices(ctx, key_types, keys, options.use_threads, &chunks,
+                             offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets) {
+  return SortToIndices(ctx, table, keys, SortOptions(), offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +29,9 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
@@ -47,5 +53,118 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief Options for sorting chunked inputs
+struct ARROW_EXPORT SortOptions {
+  /// Sort the chunks of the input in parallel on the CPU thread pool
+  bool use_threads = true;
+};
+
+/// \brief Returns the indices that would sort a chunked array.
+///
+/// Same as the array variant, the indices being logical positions in the
+/// chunked array.  Each chunk is sorted on its own, then the sorted chunks
+/// are merged: chunks are never concatenated.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to sort
+/// \param[in] options sort options
+/// \param[out] offsets indices that would sort the chunked array
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the (chunk, index in chunk) pairs that would sort a chunked array.
+///
+/// For example given values = [[3, null], [], [1, 2]], the output will be
+/// chunk_ids = [2, 2, 0, 0] and chunk_offsets = [0, 1, 0, 1]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to sort
+/// \param[in] options sort options
+/// \param[out] chunk_ids int32 indices of the chunks of the sorted values
+/// \param[out] chunk_offsets uint64 indices of the sorted values in their chunk
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToChunkedIndices(FunctionContext* ctx, const ChunkedArray& values,
+                            const SortOptions& options,
+                            std::shared_ptr<Array>* chunk_ids,
+                            std::shared_ptr<Array>* chunk_offsets);
+
+/// \brief A column to sort by, with its order and the placement of its nulls
+struct ARROW_EXPORT SortKey {
+  enum Order {
+    ASCENDING = 0,
+    DESCENDING,
+  };
+
+  enum NullPlacement {
+    /// Nulls sort after all values, whatever the order
+    NULLS_LAST = 0,
+    /// Nulls sort before all values, whatever the order
+    NULLS_FIRST,
+  };
+
+  SortKey(std::string name, Order order = ASCENDING,
+          NullPlacement null_placement = NULLS_LAST)
+      : name(std::move(name)), order(order), null_placement(null_placement) {}
+
+  /// The name of the column to sort by
+  std::string name;
+  Order order;
+  NullPlacement null_placement;
+};
+
+/// \brief Returns the indices that would sort a record batch by several columns.
+///
+/// Rows are ordered lexicographically by the sort keys: by the first key,
+/// then rows with equal values for it by the second key, and so on.  The
+/// sort is stable.  Two nulls of a column compare equal, as do two NaNs,
+/// which sort after all other values whatever the order.
+///
+/// Sorting proceeds one column at a time, never comparing whole rows: the
+/// indices are sorted by the first key, then each run of tied rows is sorted
+/// by the next key.
+///
+/// For example given batch = {"a": [1, 2, 1, null], "b": ["x", "y", "z", "w"]}
+/// and keys = [("a", ASCENDING), ("b", DESCENDING)], the output will be
+/// [2, 0, 1, 3]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] keys columns to sort by, most significant first
+/// \param[out] offsets indices that would sort the batch
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a table by several columns.
+///
+/// Same as the record batch variant, the indices being logical row numbers
+/// of the table.  The key columns are split into aligned chunks, without
+/// copying, which are sorted on their own and then merged.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] keys columns to sort by, most significant first
+/// \param[in] options sort options
+/// \param[out] offsets indices that would sort the table
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a table by several columns,
+/// using the default SortOptions
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table,
+                     const std::vector<SortKey>& keys, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
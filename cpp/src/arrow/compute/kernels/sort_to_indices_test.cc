@@ -23,6 +23,8 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -32,6 +34,7 @@
 namespace arrow {
 namespace compute {
 
+using arrow::internal::checked_cast;
 using arrow::internal::checked_pointer_cast;
 
 template <typename ArrowType>
@@ -265,5 +268,203 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+class TestSortToIndicesMultiKey : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const RecordBatch& batch, const std::vector<SortKey>& keys,
+                           const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, batch, keys, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortToIndicesMultiKey, RecordBatch) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("a", int32()), field("b", utf8()), field("c", float64())}), R"([
+    {"a": 1, "b": "x", "c": 1.5},
+    {"a": 2, "b": "y", "c": null},
+    {"a": 1, "b": "z", "c": 0.5},
+    {"a": null, "b": "w", "c": 2.5},
+    {"a": 1, "b": "x", "c": null},
+    {"a": 2, "b": null, "c": 3.5}
+  ])");
+
+  this->AssertSortToIndices(*batch, {{"a"}}, "[0, 2, 4, 1, 5, 3]");
+  this->AssertSortToIndices(*batch, {{"a", SortKey::DESCENDING}}, "[1, 5, 0, 2, 4, 3]");
+  this->AssertSortToIndices(*batch, {{"a", SortKey::ASCENDING, SortKey::NULLS_FIRST}},
+                            "[3, 0, 2, 4, 1, 5]");
+  this->AssertSortToIndices(*batch, {{"a"}, {"b", SortKey::DESCENDING}},
+                            "[2, 0, 4, 1, 5, 3]");
+  this->AssertSortToIndices(
+      *batch, {{"a"}, {"b", SortKey::ASCENDING, SortKey::NULLS_FIRST}, {"c"}},
+      "[0, 4, 2, 5, 1, 3]");
+  this->AssertSortToIndices(
+      *batch, {{"a"}, {"b"}, {"c", SortKey::DESCENDING, SortKey::NULLS_FIRST}},
+      "[4, 0, 2, 1, 5, 3]");
+  this->AssertSortToIndices(*batch->Slice(2, 3), {{"a"}, {"c"}}, "[0, 2, 1]");
+}
+
+TEST_F(TestSortToIndicesMultiKey, Table) {
+  auto schm = schema({field("a", uint8()), field("b", int64())});
+  auto table = TableFromJSON(schm, {R"([{"a": 3, "b": 1}, {"a": 1, "b": 2}])",
+                                    R"([{"a": 3, "b": 0}, {"a": null, "b": 5}])",
+                                    R"([{"a": 1, "b": -1}])"});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table,
+                          {{"a", SortKey::DESCENDING}, {"b", SortKey::DESCENDING}},
+                          &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 1, 4, 3]"), *actual);
+
+  ASSERT_OK(SortToIndices(&this->ctx_, *TableFromJSON(schm, {}), {{"a"}}, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *actual);
+}
+
+// Long key columns take the radix sort path
+TEST_F(TestSortToIndicesMultiKey, Random) {
+  random::RandomArrayGenerator generator(0x5487658);
+  const int64_t length = 4000;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto a = generator.Int16(length, -10, 10, null_probability);
+    auto b = generator.Int64(length, std::numeric_limits<int64_t>::min(),
+                             std::numeric_limits<int64_t>::max(), null_probability);
+    auto batch =
+        RecordBatch::Make(schema({field("a", int16()), field("b", int64())}), length,
+                          {a, b});
+    std::vector<SortKey> keys = {{"a", SortKey::DESCENDING, SortKey::NULLS_FIRST},
+                                 {"b", SortKey::ASCENDING}};
+    std::shared_ptr<Array> offsets;
+    ASSERT_OK(SortToIndices(&this->ctx_, *batch, keys, &offsets));
+
+    const auto& a_values = checked_cast<const Int16Array&>(*a);
+    const auto& b_values = checked_cast<const Int64Array&>(*b);
+    const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+    ASSERT_EQ(length, indices.length());
+    for (int64_t i = 1; i < length; i++) {
+      const uint64_t lhs = indices.Value(i - 1);
+      const uint64_t rhs = indices.Value(i);
+      // a: descending, nulls first
+      if (a_values.IsNull(lhs) != a_values.IsNull(rhs)) {
+        ASSERT_TRUE(a_values.IsNull(lhs));
+        continue;
+      }
+      if (a_values.IsValid(lhs) && a_values.Value(lhs) != a_values.Value(rhs)) {
+        ASSERT_GT(a_values.Value(lhs), a_values.Value(rhs));
+        continue;
+      }
+      // b: ascending, nulls last, then stable
+      if (b_values.IsNull(lhs) != b_values.IsNull(rhs)) {
+        ASSERT_TRUE(b_values.IsNull(rhs));
+        continue;
+      }
+      if (b_values.IsValid(lhs) && b_values.Value(lhs) != b_values.Value(rhs)) {
+        ASSERT_LT(b_values.Value(lhs), b_values.Value(rhs));
+        continue;
+      }
+      ASSERT_LT(lhs, rhs);
+    }
+  }
+}
+
+TEST_F(TestSortToIndicesMultiKey, Errors) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", boolean())}),
+                                   R"([{"a": 1, "b": true}])");
+  std::shared_ptr<Array> offsets;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, {}, &offsets));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, {{"z"}}, &offsets));
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *batch, {{"a"}, {"b"}}, &offsets));
+}
+
+class TestSortToIndicesChunked : public ComputeFixture, public TestBase {};
+
+TEST_F(TestSortToIndicesChunked, ChunkedArray) {
+  auto values =
+      ChunkedArrayFromJSON(int32(), {"[3, null, 1]", "[]", "[2, 1, null]", "[0]"});
+  for (bool use_threads : {false, true}) {
+    SortOptions options;
+    options.use_threads = use_threads;
+
+    std::shared_ptr<Array> offsets;
+    ASSERT_OK(SortToIndices(&this->ctx_, *values, options, &offsets));
+    AssertArraysEqual(*ArrayFromJSON(uint64(), "[6, 2, 4, 3, 0, 1, 5]"), *offsets);
+
+    std::shared_ptr<Array> chunk_ids, chunk_offsets;
+    ASSERT_OK(
+        SortToChunkedIndices(&this->ctx_, *values, options, &chunk_ids, &chunk_offsets));
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 0, 2, 2, 0, 0, 2]"), *chunk_ids);
+    AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 1, 0, 0, 1, 2]"),
+                      *chunk_offsets);
+  }
+
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(SortToIndices(&this->ctx_, *ChunkedArrayFromJSON(utf8(), {}), SortOptions(),
+                          &offsets));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *offsets);
+}
+
+// NaNs sort after all other values whatever the order, and the merged chunks
+// must order them as a single chunk does
+TEST_F(TestSortToIndicesChunked, NaN) {
+  auto values = ChunkedArrayFromJSON(float64(),
+                                     {"[3, NaN, 1]", "[null, NaN]", "[2, NaN, 0]"});
+  auto contiguous =
+      ChunkedArrayFromJSON(float64(), {"[3, NaN, 1, null, NaN, 2, NaN, 0]"});
+  for (bool use_threads : {false, true}) {
+    SortOptions options;
+    options.use_threads = use_threads;
+    std::shared_ptr<Array> offsets;
+    ASSERT_OK(SortToIndices(&this->ctx_, *values, options, &offsets));
+    AssertArraysEqual(*ArrayFromJSON(uint64(), "[7, 2, 5, 0, 1, 4, 6, 3]"), *offsets);
+    ASSERT_OK(SortToIndices(&this->ctx_, *contiguous, options, &offsets));
+    AssertArraysEqual(*ArrayFromJSON(uint64(), "[7, 2, 5, 0, 1, 4, 6, 3]"), *offsets);
+  }
+
+  auto schm = schema({field("a", float64()), field("b", int32())});
+  auto batch = RecordBatchFromJSON(schm, R"([
+    {"a": 1, "b": 2}, {"a": NaN, "b": 1}, {"a": null, "b": 0},
+    {"a": NaN, "b": 0}, {"a": 2, "b": 5}, {"a": 1, "b": 1}
+  ])");
+  auto table = TableFromJSON(
+      schm, {R"([{"a": 1, "b": 2}, {"a": NaN, "b": 1}, {"a": null, "b": 0}])",
+             R"([{"a": NaN, "b": 0}])", R"([{"a": 2, "b": 5}, {"a": 1, "b": 1}])"});
+  std::vector<SortKey> keys = {{"a", SortKey::DESCENDING, SortKey::NULLS_FIRST},
+                               {"b", SortKey::ASCENDING}};
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, keys, &offsets));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 4, 5, 0, 3, 1]"), *offsets);
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, keys, &offsets));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 4, 5, 0, 3, 1]"), *offsets);
+}
+
+// Chunks sorted in parallel and merged must agree with a sort of the
+// contiguous data
+TEST_F(TestSortToIndicesChunked, TableMatchesRecordBatch) {
+  random::RandomArrayGenerator generator(0x5487659);
+  const int64_t length = 5000;
+  auto a = generator.Int32(length, 0, 20, 0.1);
+  auto b = generator.String(length, 0, 3, 0.1);
+  auto batch = RecordBatch::Make(schema({field("a", int32()), field("b", utf8())}),
+                                 length, {a, b});
+  // Key columns with different chunk layouts
+  auto table = Table::Make(
+      batch->schema(),
+      {std::make_shared<ChunkedArray>(
+           ArrayVector{a->Slice(0, 1000), a->Slice(1000, 2500), a->Slice(3500)}),
+       std::make_shared<ChunkedArray>(ArrayVector{b->Slice(0, 3000), b->Slice(3000)})});
+  std::vector<SortKey> keys = {{"a", SortKey::DESCENDING, SortKey::NULLS_FIRST},
+                               {"b", SortKey::ASCENDING}};
+
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, keys, &expected));
+  for (bool use_threads : {false, true}) {
+    SortOptions options;
+    options.use_threads = use_threads;
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *table, keys, options, &actual));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
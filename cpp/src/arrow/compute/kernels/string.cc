@@ -0,0 +1,874 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#endif
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Stands for the data of arrays without a data buffer, so that value
+// pointers are never null
+const uint8_t kNoData[1] = {0};
+
+// Whether a range of bytes is all ASCII, tested 8 bytes at a time
+bool IsAscii(const uint8_t* data, int64_t size) {
+  uint64_t ored = 0;
+  for (; size >= 8; size -= 8, data += 8) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    ored |= word;
+  }
+  for (; size > 0; --size) {
+    ored |= *data++;
+  }
+  return (ored & 0x8080808080808080ULL) == 0;
+}
+
+inline bool IsContinuationByte(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+int64_t CountCodepoints(const uint8_t* data, int64_t size) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    count += !IsContinuationByte(data[i]);
+  }
+  return count;
+}
+
+// Advance by at most n code points, stopping at end
+const uint8_t* SkipCodepoints(const uint8_t* pos, const uint8_t* end, int64_t n) {
+  for (; pos < end && n > 0; --n) {
+    ++pos;
+    while (pos < end && IsContinuationByte(*pos)) {
+      ++pos;
+    }
+  }
+  return pos;
+}
+
+// Return the first occurrence of pattern in [pos, end), or nullptr.  The
+// first byte of the pattern is looked for with memchr, which scans many
+// bytes at a time.
+const uint8_t* FindPattern(const uint8_t* pos, const uint8_t* end,
+                           const std::string& pattern) {
+  const auto pattern_size = static_cast<int64_t>(pattern.size());
+  if (pattern_size == 0) {
+    return pos;
+  }
+  if (end - pos < pattern_size) {
+    return nullptr;
+  }
+  const uint8_t first = static_cast<uint8_t>(pattern[0]);
+  const uint8_t* last_start = end - pattern_size;
+  while (pos <= last_start) {
+    pos = static_cast<const uint8_t*>(std::memchr(pos, first, last_start - pos + 1));
+    if (pos == nullptr) {
+      return nullptr;
+    }
+    if (std::memcmp(pos + 1, pattern.data() + 1, pattern_size - 1) == 0) {
+      return pos;
+    }
+    ++pos;
+  }
+  return nullptr;
+}
+
+inline uint8_t AsciiToUpper(uint8_t c) {
+  return static_cast<uint8_t>(c ^ (static_cast<uint8_t>(c - 'a') < 26 ? 0x20 : 0));
+}
+
+inline uint8_t AsciiToLower(uint8_t c) {
+  return static_cast<uint8_t>(c ^ (static_cast<uint8_t>(c - 'A') < 26 ? 0x20 : 0));
+}
+
+inline bool InRange(uint32_t c, uint32_t first, uint32_t last) {
+  return c >= first && c <= last;
+}
+
+// Simple case mapping of the scripts whose letters are laid out as ranges or
+// pairs of upper and lower case letters.  No code point is mapped to one
+// encoded with more bytes, so that the output is at most as large as the
+// input.
+
+// Pairs of upper case letter at an even code point followed by its lower case
+inline bool IsEvenUpperPair(uint32_t c) {
+  return InRange(c, 0x100, 0x137) || InRange(c, 0x14A, 0x177) ||
+         InRange(c, 0x460, 0x481) || InRange(c, 0x48A, 0x4BF) ||
+         InRange(c, 0x4D0, 0x52F) || InRange(c, 0x1E00, 0x1E95) ||
+         InRange(c, 0x1EA0, 0x1EFF);
+}
+
+// Pairs of upper case letter at an odd code point followed by its lower case
+inline bool IsOddUpperPair(uint32_t c) {
+  return InRange(c, 0x139, 0x148) || InRange(c, 0x179, 0x17E) || InRange(c, 0x4C1, 0x4CE);
+}
+
+uint32_t UnicodeToUpper(uint32_t c) {
+  if (c < 0x80) {
+    return AsciiToUpper(static_cast<uint8_t>(c));
+  }
+  if (InRange(c, 0xE0, 0xFE) && c != 0xF7) {
+    return c - 0x20;
+  }
+  if (c == 0x131) {
+    return 'I';
+  }
+  if (IsEvenUpperPair(c)) {
+    return c & ~1u;
+  }
+  if (IsOddUpperPair(c)) {
+    return c % 2 == 0 ? c - 1 : c;
+  }
+  if ((InRange(c, 0x3B1, 0x3CB) && c != 0x3C2) || InRange(c, 0x430, 0x44F) ||
+      InRange(c, 0xFF41, 0xFF5A)) {
+    return c - 0x20;
+  }
+  if (InRange(c, 0x450, 0x45F)) {
+    return c - 0x50;
+  }
+  if (InRange(c, 0x561, 0x586)) {
+    return c - 0x30;
+  }
+  if (InRange(c, 0x3AD, 0x3AF)) {
+    return c - 0x25;
+  }
+  if (InRange(c, 0x3CD, 0x3CE)) {
+    return c - 0x3F;
+  }
+  switch (c) {
+    case 0xFF:
+      return 0x178;
+    case 0x17F:
+      return 'S';
+    case 0x3AC:
+      return 0x386;
+    case 0x3C2:
+      return 0x3A3;
+    case 0x3CC:
+      return 0x38C;
+    case 0x4CF:
+      return 0x4C0;
+    default:
+      return c;
+  }
+}
+
+uint32_t UnicodeToLower(uint32_t c) {
+  if (c < 0x80) {
+    return AsciiToLower(static_cast<uint8_t>(c));
+  }
+  if (InRange(c, 0xC0, 0xDE) && c != 0xD7) {
+    return c + 0x20;
+  }
+  if (c == 0x130) {
+    return 'i';
+  }
+  if (IsEvenUpperPair(c)) {
+    return c | 1u;
+  }
+  if (IsOddUpperPair(c)) {
+    return c % 2 == 1 ? c + 1 : c;
+  }
+  if ((InRange(c, 0x391, 0x3AB) && c != 0x3A2) || InRange(c, 0x410, 0x42F) ||
+      InRange(c, 0xFF21, 0xFF3A)) {
+    return c + 0x20;
+  }
+  if (InRange(c, 0x400, 0x40F)) {
+    return c + 0x50;
+  }
+  if (InRange(c, 0x531, 0x556)) {
+    return c + 0x30;
+  }
+  if (InRange(c, 0x388, 0x38A)) {
+    return c + 0x25;
+  }
+  if (InRange(c, 0x38E, 0x38F)) {
+    return c + 0x3F;
+  }
+  switch (c) {
+    case 0x178:
+      return 0xFF;
+    case 0x386:
+      return 0x3AC;
+    case 0x38C:
+      return 0x3CC;
+    case 0x4C0:
+      return 0x4CF;
+    case 0x1E9E:
+      return 0xDF;
+    default:
+      return c;
+  }
+}
+
+struct ToUpper {
+  static uint8_t Ascii(uint8_t c) { return AsciiToUpper(c); }
+  static uint32_t Unicode(uint32_t c) { return UnicodeToUpper(c); }
+};
+
+struct ToLower {
+  static uint8_t Ascii(uint8_t c) { return AsciiToLower(c); }
+  static uint32_t Unicode(uint32_t c) { return UnicodeToLower(c); }
+};
+
+// The values of a string or large string array, read from its buffers
+template <typename Type>
+struct StringValues {
+  using offset_type = typename Type::offset_type;
+
+  explicit StringValues(const ArrayData& array)
+      : length(array.length),
+        offsets(array.GetValues<offset_type>(1)),
+        data(array.buffers[2] != nullptr ? array.buffers[2]->data() : kNoData),
+        validity(array.null_count != 0 && array.buffers[0] != nullptr
+                     ? array.buffers[0]->data()
+                     : nullptr),
+        validity_offset(array.offset) {}
+
+  bool IsNull(int64_t i) const {
+    return validity != nullptr && !BitUtil::GetBit(validity, validity_offset + i);
+  }
+
+  const uint8_t* begin(int64_t i) const { return data + offsets[i]; }
+  const uint8_t* end(int64_t i) const { return data + offsets[i + 1]; }
+
+  // The bytes of all of the values, which are contiguous
+  const uint8_t* all_begin() const { return data + offsets[0]; }
+  int64_t all_size() const { return offsets[length] - offsets[0]; }
+
+  const int64_t length;
+  const offset_type* offsets;
+  const uint8_t* data;
+  const uint8_t* validity;
+  const int64_t validity_offset;
+};
+
+template <typename offset_type>
+Status AllocateOffsets(FunctionContext* ctx, int64_t length, std::shared_ptr<Buffer>* out,
+                       offset_type** offsets) {
+  RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(offset_type), out));
+  *offsets = reinterpret_cast<offset_type*>((*out)->mutable_data());
+  (*offsets)[0] = 0;
+  return Status::OK();
+}
+
+// Make an output of the input's nulls and the given buffers
+Status MakeOutput(FunctionContext* ctx, const ArrayData& input,
+                  std::shared_ptr<DataType> type, BufferVector buffers,
+                  std::shared_ptr<Array>* out) {
+  auto out_data = ArrayData::Make(std::move(type), input.length, std::move(buffers));
+  RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+  *out = MakeArray(out_data);
+  return Status::OK();
+}
+
+template <typename Type>
+Status Utf8LengthImpl(FunctionContext* ctx, const ArrayData& input,
+                      std::shared_ptr<Array>* out) {
+  using offset_type = typename Type::offset_type;
+  StringValues<Type> values(input);
+  std::shared_ptr<Buffer> lengths_buf;
+  RETURN_NOT_OK(ctx->Allocate(values.length * sizeof(offset_type), &lengths_buf));
+  auto lengths = reinterpret_cast<offset_type*>(lengths_buf->mutable_data());
+
+  if (IsAscii(values.all_begin(), values.all_size())) {
+    for (int64_t i = 0; i < values.length; ++i) {
+      lengths[i] = values.offsets[i + 1] - values.offsets[i];
+    }
+  } else {
+    for (int64_t i = 0; i < values.length; ++i) {
+      lengths[i] = static_cast<offset_type>(
+          CountCodepoints(values.begin(i), values.end(i) - values.begin(i)));
+    }
+  }
+  auto type = std::is_same<offset_type, int32_t>::value ? int32() : int64();
+  return MakeOutput(ctx, input, type, {nullptr, lengths_buf}, out);
+}
+
+template <typename Type, typename CaseMapping>
+Status CaseMap(FunctionContext* ctx, const ArrayData& input,
+               std::shared_ptr<Array>* out) {
+  using offset_type = typename Type::offset_type;
+  StringValues<Type> values(input);
+  std::shared_ptr<Buffer> offsets_buf, data_buf;
+  offset_type* out_offsets;
+  RETURN_NOT_OK(AllocateOffsets(ctx, values.length, &offsets_buf, &out_offsets));
+  RETURN_NOT_OK(ctx->Allocate(values.all_size(), &data_buf));
+  uint8_t* out_data = data_buf->mutable_data();
+
+  if (IsAscii(values.all_begin(), values.all_size())) {
+    // Map all of the values in a single pass, keeping their offsets
+    const uint8_t* in_data = values.all_begin();
+    for (int64_t i = 0; i < values.all_size(); ++i) {
+      out_data[i] = CaseMapping::Ascii(in_data[i]);
+    }
+    for (int64_t i = 0; i <= values.length; ++i) {
+      out_offsets[i] = values.offsets[i] - values.offsets[0];
+    }
+    return MakeOutput(ctx, input, input.type, {nullptr, offsets_buf, data_buf}, out);
+  }
+
+  uint8_t* dest = out_data;
+  for (int64_t i = 0; i < values.length; ++i) {
+    if (!values.IsNull(i)) {
+      const uint8_t* pos = values.begin(i);
+      const uint8_t* end = values.end(i);
+      while (pos < end) {
+        if (*pos < 0x80) {
+          *dest++ = CaseMapping::Ascii(*pos++);
+          continue;
+        }
+        uint32_t codepoint;
+        if (!util::UTF8Decode(&pos, end, &codepoint)) {
+          return Status::Invalid("Invalid UTF8 sequence in input");
+        }
+        dest = util::UTF8Encode(dest, CaseMapping::Unicode(codepoint));
+      }
+    }
+    out_offsets[i + 1] = static_cast<offset_type>(dest - out_data);
+  }
+  data_buf = SliceBuffer(data_buf, 0, dest - out_data);
+  return MakeOutput(ctx, input, input.type, {nullptr, offsets_buf, data_buf}, out);
+}
+
+template <typename Type, typename Predicate>
+Status MatchValues(FunctionContext* ctx, const ArrayData& input, Predicate&& predicate,
+                   std::shared_ptr<Array>* out) {
+  StringValues<Type> values(input);
+  std::shared_ptr<Buffer> bitmap;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(values.length), &bitmap));
+  int64_t i = 0;
+  internal::GenerateBitsUnrolled(bitmap->mutable_data(), 0, values.length, [&]() {
+    const bool matches = predicate(values.begin(i), values.end(i));
+    ++i;
+    return matches;
+  });
+  return MakeOutput(ctx, input, boolean(), {nullptr, bitmap}, out);
+}
+
+template <typename Type>
+Status StartsWithImpl(FunctionContext* ctx, const ArrayData& input,
+                      const std::string& pattern, std::shared_ptr<Array>* out) {
+  const auto pattern_size = static_cast<int64_t>(pattern.size());
+  return MatchValues<Type>(
+      ctx, input,
+      [&](const uint8_t* begin, const uint8_t* end) {
+        return end - begin >= pattern_size &&
+               std::memcmp(begin, pattern.data(), pattern_size) == 0;
+      },
+      out);
+}
+
+template <typename Type>
+Status EndsWithImpl(FunctionContext* ctx, const ArrayData& input,
+                    const std::string& pattern, std::shared_ptr<Array>* out) {
+  const auto pattern_size = static_cast<int64_t>(pattern.size());
+  return MatchValues<Type>(
+      ctx, input,
+      [&](const uint8_t* begin, const uint8_t* end) {
+        return end - begin >= pattern_size &&
+               std::memcmp(end - pattern_size, pattern.data(), pattern_size) == 0;
+      },
+      out);
+}
+
+template <typename Type>
+Status ContainsImpl(FunctionContext* ctx, const ArrayData& input,
+                    const std::string& pattern, std::shared_ptr<Array>* out) {
+  return MatchValues<Type>(
+      ctx, input,
+      [&](const uint8_t* begin, const uint8_t* end) {
+        return FindPattern(begin, end, pattern) != nullptr;
+      },
+      out);
+}
+
+template <typename Type>
+Status SubstringImpl(FunctionContext* ctx, const ArrayData& input, int64_t start,
+                     int64_t length, std::shared_ptr<Array>* out) {
+  using offset_type = typename Type::offset_type;
+  if (length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ", length);
+  }
+  StringValues<Type> values(input);
+  std::shared_ptr<Buffer> offsets_buf, data_buf;
+  offset_type* out_offsets;
+  RETURN_NOT_OK(AllocateOffsets(ctx, values.length, &offsets_buf, &out_offsets));
+  RETURN_NOT_OK(ctx->Allocate(values.all_size(), &data_buf));
+  uint8_t* out_data = data_buf->mutable_data();
+
+  // Code points are bytes in ASCII
+  const bool ascii = IsAscii(values.all_begin(), values.all_size());
+  uint8_t* dest = out_data;
+  for (int64_t i = 0; i < values.length; ++i) {
+    const uint8_t* begin = values.begin(i);
+    const uint8_t* end = values.end(i);
+    if (start < 0) {
+      const int64_t num_codepoints =
+          ascii ? end - begin : CountCodepoints(begin, end - begin);
+      const int64_t skip = std::max<int64_t>(num_codepoints + start, 0);
+      begin = ascii ? begin + skip : SkipCodepoints(begin, end, skip);
+    } else {
+      begin = ascii ? begin + std::min<int64_t>(start, end - begin)
+                    : SkipCodepoints(begin, end, start);
+    }
+    end = ascii ? begin + std::min<int64_t>(length, end - begin)
+                : SkipCodepoints(begin, end, length);
+    std::memcpy(dest, begin, end - begin);
+    dest += end - begin;
+    out_offsets[i + 1] = static_cast<offset_type>(dest - out_data);
+  }
+  data_buf = SliceBuffer(data_buf, 0, dest - out_data);
+  return MakeOutput(ctx, input, input.type, {nullptr, offsets_buf, data_buf}, out);
+}
+
+template <typename Type>
+Status SplitImpl(FunctionContext* ctx, const ArrayData& input,
+                 const std::string& separator, int64_t max_splits,
+                 std::shared_ptr<Array>* out) {
+  using offset_type = typename Type::offset_type;
+  using OutListType =
+      typename std::conditional<std::is_same<offset_type, int32_t>::value, ListType,
+                                LargeListType>::type;
+  if (separator.empty()) {
+    return Status::Invalid("Split separator must not be empty");
+  }
+  StringValues<Type> values(input);
+  std::shared_ptr<Buffer> list_offsets_buf, data_buf;
+  offset_type* list_offsets;
+  RETURN_NOT_OK(AllocateOffsets(ctx, values.length, &list_offsets_buf, &list_offsets));
+  // The pieces are the values without the separators
+  RETURN_NOT_OK(ctx->Allocate(values.all_size(), &data_buf));
+  uint8_t* out_data = data_buf->mutable_data();
+  TypedBufferBuilder<offset_type> piece_offsets(ctx->memory_pool());
+  RETURN_NOT_OK(piece_offsets.Reserve(values.length + 1));
+  piece_offsets.UnsafeAppend(0);
+
+  uint8_t* dest = out_data;
+  int64_t num_pieces = 0;
+  for (int64_t i = 0; i < values.length; ++i) {
+    if (!values.IsNull(i)) {
+      const uint8_t* pos = values.begin(i);
+      const uint8_t* end = values.end(i);
+      for (int64_t num_splits = 0;; ++num_splits) {
+        const uint8_t* found = max_splits < 0 || num_splits < max_splits
+                                   ? FindPattern(pos, end, separator)
+                                   : nullptr;
+        const uint8_t* piece_end = found != nullptr ? found : end;
+        std::memcpy(dest, pos, piece_end - pos);
+        dest += piece_end - pos;
+        RETURN_NOT_OK(piece_offsets.Append(static_cast<offset_type>(dest - out_data)));
+        ++num_pieces;
+        if (found == nullptr) {
+          break;
+        }
+        pos = found + separator.size();
+      }
+    }
+    list_offsets[i + 1] = static_cast<offset_type>(num_pieces);
+  }
+
+  std::shared_ptr<Buffer> piece_offsets_buf;
+  RETURN_NOT_OK(piece_offsets.Finish(&piece_offsets_buf));
+  data_buf = SliceBuffer(data_buf, 0, dest - out_data);
+  auto pieces = ArrayData::Make(input.type, num_pieces,
+                                {nullptr, piece_offsets_buf, data_buf}, /*null_count=*/0);
+  auto lists = ArrayData::Make(std::make_shared<OutListType>(input.type), values.length,
+                               {nullptr, list_offsets_buf});
+  lists->child_data.push_back(std::move(pieces));
+  RETURN_NOT_OK(detail::PropagateNulls(ctx, input, lists.get()));
+  *out = MakeArray(lists);
+  return Status::OK();
+}
+
+// A token of a LIKE pattern
+struct LikeToken {
+  enum Kind : uint8_t { kByte, kAnyChar, kAnyString };
+
+  Kind kind;
+  uint8_t byte;
+};
+
+// Match a string against LIKE tokens.  On a mismatch, the last '%' is made to
+// match one more character and matching resumes after it; earlier '%' never
+// need to match more.
+bool MatchLikeTokens(const uint8_t* pos, const uint8_t* end, const LikeToken* token,
+                     const LikeToken* tokens_end) {
+  const LikeToken* resume_token = nullptr;
+  const uint8_t* resume_pos = nullptr;
+  while (pos < end) {
+    if (token < tokens_end && token->kind == LikeToken::kAnyString) {
+      resume_token = ++token;
+      resume_pos = pos;
+    } else if (token < tokens_end && token->kind == LikeToken::kAnyChar) {
+      pos = SkipCodepoints(pos, end, 1);
+      ++token;
+    } else if (token < tokens_end && *pos == token->byte) {
+      ++pos;
+      ++token;
+    } else if (resume_token != nullptr) {
+      token = resume_token;
+      pos = resume_pos = SkipCodepoints(resume_pos, end, 1);
+    } else {
+      return false;
+    }
+  }
+  while (token < tokens_end && token->kind == LikeToken::kAnyString) {
+    ++token;
+  }
+  return token == tokens_end;
+}
+
+class LikeMatcher {
+ public:
+  Status Init(const std::string& pattern) {
+    for (size_t i = 0; i < pattern.size(); ++i) {
+      const auto c = static_cast<uint8_t>(pattern[i]);
+      if (c == '\\') {
+        if (++i == pattern.size()) {
+          return Status::Invalid("LIKE pattern '", pattern,
+                                 "' ends with an escape character");
+        }
+        tokens_.push_back({LikeToken::kByte, static_cast<uint8_t>(pattern[i])});
+      } else if (c == '%') {
+        // Consecutive '%' match the same as a single one
+        if (tokens_.empty() || tokens_.back().kind != LikeToken::kAnyString) {
+          tokens_.push_back({LikeToken::kAnyString, 0});
+        }
+      } else if (c == '_') {
+        tokens_.push_back({LikeToken::kAnyChar, 0});
+        has_any_char_ = true;
+      } else {
+        tokens_.push_back({LikeToken::kByte, c});
+      }
+    }
+
+    // Gather the literal runs between wildcards
+    std::string run;
+    for (const auto& token : tokens_) {
+      if (token.kind == LikeToken::kByte) {
+        run.push_back(static_cast<char>(token.byte));
+        continue;
+      }
+      if (token.kind == LikeToken::kAnyString) {
+        segments_.push_back(run);
+      }
+      if (run.size() > longest_literal_.size()) {
+        longest_literal_ = run;
+      }
+      run.clear();
+    }
+    segments_.push_back(run);
+    if (run.size() > longest_literal_.size()) {
+      longest_literal_ = run;
+    }
+    return Status::OK();
+  }
+
+  bool Match(const uint8_t* begin, const uint8_t* end) const {
+    if (has_any_char_) {
+      return FindPattern(begin, end, longest_literal_) != nullptr &&
+             MatchLikeTokens(begin, end, tokens_.data(), tokens_.data() + tokens_.size());
+    }
+    return MatchSegments(begin, end);
+  }
+
+ private:
+  // Without '_', the pattern matches if the string starts with the first
+  // segment, ends with the last one and has the others in between, in order
+  // and without overlap.
+  bool MatchSegments(const uint8_t* begin, const uint8_t* end) const {
+    const std::string& first = segments_.front();
+    const std::string& last = segments_.back();
+    if (segments_.size() == 1) {
+      return end - begin == static_cast<int64_t>(first.size()) &&
+             std::memcmp(begin, first.data(), first.size()) == 0;
+    }
+    if (end - begin < static_cast<int64_t>(first.size() + last.size()) ||
+        std::memcmp(begin, first.data(), first.size()) != 0 ||
+        std::memcmp(end - last.size(), last.data(), last.size()) != 0) {
+      return false;
+    }
+    begin += first.size();
+    end -= last.size();
+    for (size_t i = 1; i < segments_.size() - 1; ++i) {
+      begin = FindPattern(begin, end, segments_[i]);
+      if (begin == nullptr) {
+        return false;
+      }
+      begin += segments_[i].size();
+    }
+    return true;
+  }
+
+  std::vector<LikeToken> tokens_;
+  bool has_any_char_ = false;
+  // The literal runs separated by '%', or the whole pattern
+  std::vector<std::string> segments_;
+  std::string longest_literal_;
+};
+
+template <typename Type>
+Status MatchLikeImpl(FunctionContext* ctx, const ArrayData& input,
+                     const std::string& pattern, std::shared_ptr<Array>* out) {
+  LikeMatcher matcher;
+  RETURN_NOT_OK(matcher.Init(pattern));
+  return MatchValues<Type>(
+      ctx, input,
+      [&](const uint8_t* begin, const uint8_t* end) { return matcher.Match(begin, end); },
+      out);
+}
+
+#ifdef ARROW_WITH_RE2
+
+// Return the longest run of bytes that any match of a regular expression
+// contains, or an empty string if none was found.  This errs on the side of
+// finding nothing: alternations and flags give up, and groups, classes and
+// escapes other than of punctuation end a run.
+std::string RequiredLiteral(const std::string& regex) {
+  if (regex.find('|') != std::string::npos || regex.find("(?") != std::string::npos) {
+    return "";
+  }
+  std::string longest, run;
+  auto end_run = [&]() {
+    if (run.size() > longest.size()) {
+      longest = run;
+    }
+    run.clear();
+  };
+  // The last character may be repeated 0 times, drop all of its bytes
+  auto drop_last = [&]() {
+    while (!run.empty() && IsContinuationByte(static_cast<uint8_t>(run.back()))) {
+      run.pop_back();
+    }
+    if (!run.empty()) {
+      run.pop_back();
+    }
+    end_run();
+  };
+  auto is_alnum = [](char c) { return std::isalnum(static_cast<uint8_t>(c)) != 0; };
+  auto is_punct = [](char c) { return std::ispunct(static_cast<uint8_t>(c)) != 0; };
+  int depth = 0;
+  for (size_t i = 0; i < regex.size(); ++i) {
+    const char c = regex[i];
+    switch (c) {
+      case '\\':
+        if (i + 1 < regex.size() && is_punct(regex[i + 1])) {
+          if (depth == 0) {
+            run.push_back(regex[i + 1]);
+          }
+          ++i;
+        } else {
+          // Skip the escape along with any code or name following it
+          for (++i; i + 1 < regex.size() && is_alnum(regex[i + 1]); ++i) {
+          }
+          end_run();
+        }
+        break;
+      case '[':
+        // Skip the class, in which a leading ']' is literal, as are the ']' of
+        // the POSIX classes it holds, e.g. [[:digit:]]
+        i += (i + 1 < regex.size() && regex[i + 1] == '^') ? 2 : 1;
+        for (i += (i < regex.size() && regex[i] == ']'); i < regex.size(); ++i) {
+          if (regex[i] == '\\') {
+            ++i;
+          } else if (regex[i] == '[' && i + 1 < regex.size() &&
+                     (regex[i + 1] == ':' || regex[i + 1] == '=' ||
+                      regex[i + 1] == '.')) {
+            const size_t close = regex.find(std::string{regex[i + 1], ']'}, i + 2);
+            if (close == std::string::npos) {
+              // Not a class RE2 accepts, require nothing
+              return "";
+            }
+            i = close + 1;
+          } else if (regex[i] == ']') {
+            break;
+          }
+        }
+        end_run();
+        break;
+      case '(':
+        ++depth;
+        end_run();
+        break;
+      case ')':
+        --depth;
+        end_run();
+        break;
+      case '{':
+        i = std::min(regex.find('}', i), regex.size());
+        drop_last();
+        break;
+      case '?':
+      case '*':
+        drop_last();
+        break;
+      case '+':
+      case '.':
+      case '^':
+      case '$':
+        end_run();
+        break;
+      default:
+        if (depth == 0) {
+          run.push_back(c);
+        }
+        break;
+    }
+  }
+  end_run();
+  return longest;
+}
+
+template <typename Type>
+Status MatchRegexImpl(FunctionContext* ctx, const ArrayData& input,
+                      const std::string& pattern, std::shared_ptr<Array>* out) {
+  RE2::Options options;
+  options.set_log_errors(false);
+  RE2 regex(pattern, options);
+  if (!regex.ok()) {
+    return Status::Invalid("Invalid regular expression '", pattern, "': ",
+                           regex.error());
+  }
+  const std::string literal = RequiredLiteral(pattern);
+  if (literal.size() == pattern.size()) {
+    // The expression is a literal
+    return ContainsImpl<Type>(ctx, input, literal, out);
+  }
+  return MatchValues<Type>(
+      ctx, input,
+      [&](const uint8_t* begin, const uint8_t* end) {
+        return FindPattern(begin, end, literal) != nullptr &&
+               RE2::PartialMatch(re2::StringPiece(reinterpret_cast<const char*>(begin),
+                                                  end - begin),
+                                 regex);
+      },
+      out);
+}
+
+#endif  // ARROW_WITH_RE2
+
+}  // namespace
+
+#define STRING_KERNEL_DISPATCH(NAME, IMPL, VALUES, ...)                        \
+  switch (VALUES.type_id()) {                                                  \
+    case Type::STRING:                                                         \
+      return IMPL<StringType>(ctx, *VALUES.data(), __VA_ARGS__);               \
+    case Type::LARGE_STRING:                                                   \
+      return IMPL<LargeStringType>(ctx, *VALUES.data(), __VA_ARGS__);          \
+    default:                                                                   \
+      return Status::NotImplemented(NAME " not implemented for type ",         \
+                                    *VALUES.type());                           \
+  }
+
+Status Utf8Length(FunctionContext* ctx, const Array& values,
+                  std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("Utf8Length", Utf8LengthImpl, values, out);
+}
+
+Status Utf8Upper(FunctionContext* ctx, const Array& values,
+                 std::shared_ptr<Array>* out) {
+  switch (values.type_id()) {
+    case Type::STRING:
+      return CaseMap<StringType, ToUpper>(ctx, *values.data(), out);
+    case Type::LARGE_STRING:
+      return CaseMap<LargeStringType, ToUpper>(ctx, *values.data(), out);
+    default:
+      return Status::NotImplemented("Utf8Upper not implemented for type ",
+                                    *values.type());
+  }
+}
+
+Status Utf8Lower(FunctionContext* ctx, const Array& values,
+                 std::shared_ptr<Array>* out) {
+  switch (values.type_id()) {
+    case Type::STRING:
+      return CaseMap<StringType, ToLower>(ctx, *values.data(), out);
+    case Type::LARGE_STRING:
+      return CaseMap<LargeStringType, ToLower>(ctx, *values.data(), out);
+    default:
+      return Status::NotImplemented("Utf8Lower not implemented for type ",
+                                    *values.type());
+  }
+}
+
+Status StartsWith(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                  std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("StartsWith", StartsWithImpl, values, pattern, out);
+}
+
+Status EndsWith(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("EndsWith", EndsWithImpl, values, pattern, out);
+}
+
+Status Contains(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("Contains", ContainsImpl, values, pattern, out);
+}
+
+Status Substring(FunctionContext* ctx, const Array& values, int64_t start, int64_t length,
+                 std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("Substring", SubstringImpl, values, start, length, out);
+}
+
+Status Split(FunctionContext* ctx, const Array& values, const std::string& separator,
+             int64_t max_splits, std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("Split", SplitImpl, values, separator, max_splits, out);
+}
+
+Status MatchLike(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                 std::shared_ptr<Array>* out) {
+  STRING_KERNEL_DISPATCH("MatchLike", MatchLikeImpl, values, pattern, out);
+}
+
+Status MatchRegex(FunctionContext* ctx, const Array& values, const std::string& regex,
+                  std::shared_ptr<Array>* out) {
+#ifdef ARROW_WITH_RE2
+  STRING_KERNEL_DISPATCH("MatchRegex", MatchRegexImpl, values, regex, out);
+#else
+  return Status::NotImplemented("MatchRegex requires Arrow to be built with RE2");
+#endif
+}
+
+#undef STRING_KERNEL_DISPATCH
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+class FunctionContext;
+
+// All of the kernels below take a string or large string array, and output
+// null where the input is null.
+
+/// \brief Compute the number of code points of each string
+///
+/// For example given values = ["abc", null, "héhé"], the output will be
+/// [3, null, 4]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[out] out int32 lengths, int64 for large strings
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* out);
+
+/// \brief Convert each string to upper case
+///
+/// Case mapping is one to one, of code points in the Latin, Greek,
+/// Cyrillic and Armenian scripts and of fullwidth Latin letters.  Other code
+/// points are left unchanged.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[out] out the strings in upper case
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* out);
+
+/// \brief Convert each string to lower case
+///
+/// Same as Utf8Upper.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[out] out the strings in lower case
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* out);
+
+/// \brief Test whether each string starts with a pattern
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] pattern the prefix to look for
+/// \param[out] out boolean array
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                  std::shared_ptr<Array>* out);
+
+/// \brief Test whether each string ends with a pattern
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] pattern the suffix to look for
+/// \param[out] out boolean array
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                std::shared_ptr<Array>* out);
+
+/// \brief Test whether each string contains a pattern
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] pattern the substring to look for
+/// \param[out] out boolean array
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Contains(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                std::shared_ptr<Array>* out);
+
+/// \brief Test whether each string matches a SQL LIKE pattern
+///
+/// In the pattern, '%' matches any number of characters, '_' matches a
+/// single character and '\' escapes the character following it.  The
+/// pattern must match the whole string.
+///
+/// The literal parts of the pattern are searched for with memchr before
+/// any wildcard is matched, so that most strings are rejected early.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] pattern the LIKE pattern
+/// \param[out] out boolean array
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchLike(FunctionContext* ctx, const Array& values, const std::string& pattern,
+                 std::shared_ptr<Array>* out);
+
+/// \brief Test whether each string contains a match of a regular expression
+///
+/// The regular expression uses the RE2 syntax.  Strings that do not contain
+/// a literal required by the expression are rejected without running it.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] regex the regular expression
+/// \param[out] out boolean array
+/// \note API not yet finalized; requires Arrow to be built with RE2
+/// (ARROW_WITH_RE2)
+ARROW_EXPORT
+Status MatchRegex(FunctionContext* ctx, const Array& values, const std::string& regex,
+                  std::shared_ptr<Array>* out);
+
+/// \brief Extract a substring of each string
+///
+/// The substring starts at code point start, counted from the end of the
+/// string if negative, and is at most length code points long.
+///
+/// For example given values = ["hello", "hé", null], start = -3 and
+/// length = 2, the output will be ["ll", "hé", null]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] start the first code point of the substrings
+/// \param[in] length the maximum number of code points of the substrings
+/// \param[out] out the substrings
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* ctx, const Array& values, int64_t start, int64_t length,
+                 std::shared_ptr<Array>* out);
+
+/// \brief Split each string around a separator
+///
+/// For example given values = ["a,b", "", null, "a,,b"] and separator = ",",
+/// the output will be [["a", "b"], [""], null, ["a", "", "b"]]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values the strings
+/// \param[in] separator the non-empty separator
+/// \param[in] max_splits the maximum number of splits of each string, from the
+/// left, or -1 for no maximum
+/// \param[out] out list of strings, large list of large strings for large
+/// strings
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Split(FunctionContext* ctx, const Array& values, const std::string& separator,
+             int64_t max_splits, std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
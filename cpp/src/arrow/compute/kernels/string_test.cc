@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/utf8.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+using StringFunction = Status (*)(FunctionContext*, const Array&,
+                                  std::shared_ptr<Array>*);
+using PatternFunction = Status (*)(FunctionContext*, const Array&, const std::string&,
+                                   std::shared_ptr<Array>*);
+
+template <typename ArrowType>
+class TestStringKernel : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override { util::InitializeUTF8(); }
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<DataType> offset_type() {
+    return std::is_same<ArrowType, StringType>::value ? int32() : int64();
+  }
+
+  std::shared_ptr<DataType> list_type() {
+    if (std::is_same<ArrowType, StringType>::value) {
+      return list(type());
+    }
+    return large_list(type());
+  }
+
+  void AssertOutput(const Array& expected, const std::shared_ptr<Array>& actual) {
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(expected, *actual);
+  }
+
+  void AssertUnary(StringFunction fn, const std::string& values,
+                   const std::shared_ptr<DataType>& out_type,
+                   const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(fn(&this->ctx_, *ArrayFromJSON(type(), values), &actual));
+    AssertOutput(*ArrayFromJSON(out_type, expected), actual);
+  }
+
+  void AssertPattern(PatternFunction fn, const std::string& values,
+                     const std::string& pattern, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(fn(&this->ctx_, *ArrayFromJSON(type(), values), pattern, &actual));
+    AssertOutput(*ArrayFromJSON(boolean(), expected), actual);
+  }
+
+  void AssertSubstring(const std::string& values, int64_t start, int64_t length,
+                       const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(Substring(&this->ctx_, *ArrayFromJSON(type(), values), start, length,
+                        &actual));
+    AssertOutput(*ArrayFromJSON(type(), expected), actual);
+  }
+
+  void AssertSplit(const std::string& values, const std::string& separator,
+                   int64_t max_splits, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(Split(&this->ctx_, *ArrayFromJSON(type(), values), separator, max_splits,
+                    &actual));
+    AssertOutput(*ArrayFromJSON(list_type(), expected), actual);
+  }
+};
+
+using StringTypes = ::testing::Types<StringType, LargeStringType>;
+
+TYPED_TEST_CASE(TestStringKernel, StringTypes);
+
+TYPED_TEST(TestStringKernel, Utf8Length) {
+  auto type = this->offset_type();
+  this->AssertUnary(Utf8Length, "[]", type, "[]");
+  this->AssertUnary(Utf8Length, R"(["abc", null, "", "héhé", "€uro"])", type,
+                    "[3, null, 0, 4, 4]");
+
+  std::shared_ptr<Array> actual;
+  auto values = ArrayFromJSON(this->type(), R"(["skipped", "ab", null, "ΑΒΓ"])");
+  ASSERT_OK(Utf8Length(&this->ctx_, *values->Slice(1), &actual));
+  this->AssertOutput(*ArrayFromJSON(type, "[2, null, 3]"), actual);
+}
+
+TYPED_TEST(TestStringKernel, CaseMapping) {
+  auto type = this->type();
+  this->AssertUnary(Utf8Upper, "[]", type, "[]");
+  this->AssertUnary(Utf8Upper, R"(["aBc", null, "", "x1-"])", type,
+                    R"(["ABC", null, "", "X1-"])");
+  this->AssertUnary(Utf8Lower, R"(["aBc", null, "", "X1-"])", type,
+                    R"(["abc", null, "", "x1-"])");
+
+  this->AssertUnary(Utf8Upper, R"(["héhé", null, "straße", "αβγ ς", "привет"])", type,
+                    R"(["HÉHÉ", null, "STRAßE", "ΑΒΓ Σ", "ПРИВЕТ"])");
+  this->AssertUnary(Utf8Upper, R"(["ıÿ", "ǆ"])", type, R"(["IŸ", "ǆ"])");
+  this->AssertUnary(Utf8Lower, R"(["HÉHÉ", null, "ΑΒΓ", "ПРИВЕТ", "€"])", type,
+                    R"(["héhé", null, "αβγ", "привет", "€"])");
+  this->AssertUnary(Utf8Lower, R"(["İŸ"])", type, R"(["iÿ"])");
+
+  std::shared_ptr<Array> actual;
+  auto values = ArrayFromJSON(type, R"(["skipped", "ab", null, "ÀÉ"])");
+  ASSERT_OK(Utf8Lower(&this->ctx_, *values->Slice(1), &actual));
+  this->AssertOutput(*ArrayFromJSON(type, R"(["ab", null, "àé"])"), actual);
+}
+
+TYPED_TEST(TestStringKernel, CaseMappingInvalid) {
+  std::shared_ptr<Array> values, actual;
+  ArrayFromVector<TypeParam, std::string>({"a\xff", "b"}, &values);
+  ASSERT_RAISES_WITH_MESSAGE(Invalid, "Invalid: Invalid UTF8 sequence in input",
+                             Utf8Upper(&this->ctx_, *values, &actual));
+}
+
+TYPED_TEST(TestStringKernel, Predicates) {
+  const char* values = R"(["hello", null, "", "hell", "oh hello", "héllo"])";
+  this->AssertPattern(StartsWith, values, "hell",
+                      "[true, null, false, true, false, false]");
+  this->AssertPattern(EndsWith, values, "llo", "[true, null, false, false, true, true]");
+  this->AssertPattern(Contains, values, "ll", "[true, null, false, true, true, true]");
+  this->AssertPattern(Contains, values, "é", "[false, null, false, false, false, true]");
+  this->AssertPattern(Contains, values, "", "[true, null, true, true, true, true]");
+  this->AssertPattern(Contains, R"(["aab", "abab", "aaa"])", "ab", "[true, true, false]");
+}
+
+TYPED_TEST(TestStringKernel, MatchLike) {
+  const char* values = R"(["abc", "aXbc", "", null, "ab", "abcabc", "héllo", "a%c"])";
+  this->AssertPattern(MatchLike, values, "abc",
+                      "[true, false, false, null, false, false, false, false]");
+  this->AssertPattern(MatchLike, values, "a%",
+                      "[true, true, false, null, true, true, false, true]");
+  this->AssertPattern(MatchLike, values, "%c",
+                      "[true, true, false, null, false, true, false, true]");
+  this->AssertPattern(MatchLike, values, "a%b%c",
+                      "[true, true, false, null, false, true, false, false]");
+  this->AssertPattern(MatchLike, values, "%bc%bc",
+                      "[false, false, false, null, false, true, false, false]");
+  this->AssertPattern(MatchLike, values, "a_c",
+                      "[true, false, false, null, false, false, false, true]");
+  this->AssertPattern(MatchLike, values, "%l_o",
+                      "[false, false, false, null, false, false, true, false]");
+  this->AssertPattern(MatchLike, values, "h_llo",
+                      "[false, false, false, null, false, false, true, false]");
+  this->AssertPattern(MatchLike, values, "a\\%c",
+                      "[false, false, false, null, false, false, false, true]");
+  this->AssertPattern(MatchLike, values, "",
+                      "[false, false, true, null, false, false, false, false]");
+  this->AssertPattern(MatchLike, values, "%%",
+                      "[true, true, true, null, true, true, true, true]");
+  this->AssertPattern(MatchLike, R"(["aba", "abba"])", "ab%ba", "[false, true]");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid, "Invalid: LIKE pattern 'a\\' ends with an escape character",
+      MatchLike(&this->ctx_, *ArrayFromJSON(this->type(), "[]"), "a\\", &actual));
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernel, MatchRegex) {
+  const char* values = R"(["abc", "aXbc", "", null, "ab", "héllo", "a.c"])";
+  this->AssertPattern(MatchRegex, values, "bc",
+                      "[true, true, false, null, false, false, false]");
+  this->AssertPattern(MatchRegex, values, "^ab",
+                      "[true, false, false, null, true, false, false]");
+  this->AssertPattern(MatchRegex, values, "a.?c",
+                      "[true, false, false, null, false, false, true]");
+  this->AssertPattern(MatchRegex, values, "a\\.c",
+                      "[false, false, false, null, false, false, true]");
+  this->AssertPattern(MatchRegex, values, "h[eé]l{2}o",
+                      "[false, false, false, null, false, true, false]");
+  this->AssertPattern(MatchRegex, values, "(?i)X|é",
+                      "[false, true, false, null, false, true, false]");
+  this->AssertPattern(MatchRegex, values, "a\\x62c",
+                      "[true, false, false, null, false, false, false]");
+
+  // Literals after bracket expressions holding POSIX classes or ']'
+  const char* classes = R"(["5x", "x", "a1z", "ab2z", "]x", "a]z", "5]x"])";
+  this->AssertPattern(MatchRegex, classes, "[[:digit:]]x",
+                      "[true, false, false, false, false, false, false]");
+  this->AssertPattern(MatchRegex, classes, "a[[:alpha:][:digit:]]+z",
+                      "[false, false, true, true, false, false, false]");
+  this->AssertPattern(MatchRegex, classes, "a[\\]]z",
+                      "[false, false, false, false, false, true, false]");
+  this->AssertPattern(MatchRegex, classes, "[]5]x",
+                      "[true, false, false, false, true, false, true]");
+
+  std::shared_ptr<Array> actual;
+  auto empty = ArrayFromJSON(this->type(), "[]");
+  ASSERT_RAISES(Invalid, MatchRegex(&this->ctx_, *empty, "[", &actual));
+}
+#endif
+
+TYPED_TEST(TestStringKernel, Substring) {
+  this->AssertSubstring(R"(["hello", "hé", null, ""])", 1, 3,
+                        R"(["ell", "é", null, ""])");
+  this->AssertSubstring(R"(["hello", "hé", null, ""])", -3, 2,
+                        R"(["ll", "hé", null, ""])");
+  this->AssertSubstring(R"(["hello", "héhé"])", 10, 2, R"(["", ""])");
+  this->AssertSubstring(R"(["hello", "héhé"])", 0, 0, R"(["", ""])");
+  this->AssertSubstring(R"(["αβγδ", "héhé"])", 1, 2, R"(["βγ", "éh"])");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid, "Invalid: Substring length must be non-negative, got -1",
+      Substring(&this->ctx_, *ArrayFromJSON(this->type(), "[]"), 0, -1, &actual));
+}
+
+TYPED_TEST(TestStringKernel, Split) {
+  this->AssertSplit(R"(["a,b", "", null, "a,,b", ",é,"])", ",", -1,
+                    R"([["a", "b"], [""], null, ["a", "", "b"], ["", "é", ""]])");
+  this->AssertSplit(R"(["a,b,c", "a"])", ",", 1, R"([["a", "b,c"], ["a"]])");
+  this->AssertSplit(R"(["a,b,c"])", ",", 0, R"([["a,b,c"]])");
+  this->AssertSplit(R"(["a::b:c"])", "::", -1, R"([["a", "b:c"]])");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid, "Invalid: Split separator must not be empty",
+      Split(&this->ctx_, *ArrayFromJSON(this->type(), "[]"), "", -1, &actual));
+}
+
+TEST(TestStringKernelErrors, UnsupportedType) {
+  FunctionContext ctx;
+  std::shared_ptr<Array> actual;
+  ASSERT_RAISES(NotImplemented,
+                Utf8Length(&ctx, *ArrayFromJSON(int32(), "[1]"), &actual));
+  ASSERT_RAISES(NotImplemented,
+                Contains(&ctx, *ArrayFromJSON(binary(), R"(["a"])"), "a", &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
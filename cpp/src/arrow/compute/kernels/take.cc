@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
 
@@ -46,9 +48,80 @@ class TakeKernelImpl : public TakeKernel {
     return taker_->Finish(out);
   }
 
+  Status Take(FunctionContext* ctx, const ChunkedArray& values,
+              const Array& indices_array, std::shared_ptr<Array>* out) override {
+    const auto& indices = checked_cast<const NumericArray<IndexType>&>(indices_array);
+    std::vector<int64_t> chunk_offsets(values.num_chunks() + 1, 0);
+    for (int i = 0; i < values.num_chunks(); ++i) {
+      chunk_offsets[i + 1] = chunk_offsets[i] + values.chunk(i)->length();
+    }
+
+    // Split indices into runs of indices into the same chunk, null indices
+    // joining the run they're in
+    struct ChunkRun {
+      int chunk;
+      int64_t offset, length;
+    };
+    std::vector<ChunkRun> runs;
+    int chunk = -1;
+    int64_t chunk_begin = 0, chunk_end = 0, run_offset = 0;
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      if (indices.IsNull(i)) {
+        continue;
+      }
+      const auto index = static_cast<int64_t>(indices.Value(i));
+      if (index >= chunk_begin && index < chunk_end) {
+        continue;
+      }
+      if (index < 0 || index >= values.length()) {
+        return Status::IndexError("take index out of bounds");
+      }
+      if (chunk != -1) {
+        runs.push_back({chunk, run_offset, i - run_offset});
+        run_offset = i;
+      }
+      chunk = static_cast<int>(std::upper_bound(chunk_offsets.begin(),
+                                                chunk_offsets.end(), index) -
+                               chunk_offsets.begin()) -
+              1;
+      chunk_begin = chunk_offsets[chunk];
+      chunk_end = chunk_offsets[chunk + 1];
+    }
+
+    if (chunk == -1) {
+      // Every index is null, so any array of the type will do
+      std::shared_ptr<Array> empty;
+      RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), values.type(), 0, &empty));
+      return Take(ctx, *empty, indices, out);
+    }
+    runs.push_back({chunk, run_offset, indices.length() - run_offset});
+
+    if (static_cast<int64_t>(runs.size()) * kRunCost > values.length()) {
+      std::shared_ptr<Array> concatenated;
+      RETURN_NOT_OK(Concatenate(values.chunks(), ctx->memory_pool(), &concatenated));
+      return Take(ctx, *concatenated, indices, out);
+    }
+
+    RETURN_NOT_OK(taker_->SetContext(ctx));
+    for (const ChunkRun& run : runs) {
+      auto run_indices = indices.Slice(run.offset, run.length);
+      ArrayIndexSequence<IndexType> sequence(*run_indices, chunk_offsets[run.chunk]);
+      sequence.set_never_out_of_bounds();
+      RETURN_NOT_OK(taker_->Take(*values.chunk(run.chunk), sequence));
+    }
+    return taker_->Finish(out);
+  }
+
+  // Taking a run of indices from a chunk costs about as much as copying this
+  // many values when concatenating chunks
+  static constexpr int64_t kRunCost = 16;
+
   std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker_;
 };
 
+template <typename IndexType>
+constexpr int64_t TakeKernelImpl<IndexType>::kRunCost;
+
 struct UnpackIndices {
   template <typename IndexType>
   enable_if_integer<IndexType, Status> Visit(const IndexType&) {
@@ -103,45 +176,38 @@ Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
 
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
-
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
+  std::shared_ptr<Array> taken;
+  if (values.num_chunks() == 1) {
+    RETURN_NOT_OK(Take(ctx, *values.chunk(0), indices, options, &taken));
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &current_chunk));
+    std::unique_ptr<TakeKernel> kernel;
+    RETURN_NOT_OK(TakeKernel::Make(values.type(), indices.type(), &kernel));
+    RETURN_NOT_OK(kernel->Take(ctx, values, indices, &taken));
   }
-  // Call Array Take on our single chunk
-  RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  *out = std::make_shared<ChunkedArray>(ArrayVector{taken}, values.type());
   return Status::OK();
 }
 
+// The chunks of a chunked array as a single array
+static Status ConcatenateChunks(MemoryPool* pool, const ChunkedArray& values,
+                                std::shared_ptr<Array>* out) {
+  switch (values.num_chunks()) {
+    case 0:
+      return MakeArrayOfNull(pool, values.type(), 0, out);
+    case 1:
+      *out = values.chunk(0);
+      return Status::OK();
+    default:
+      return Concatenate(values.chunks(), pool, out);
+  }
+}
+
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = indices.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<ChunkedArray> current_chunk;
-
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
-  }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
-  return Status::OK();
+  // Concatenate the chunks of values once, rather than once per chunk of indices
+  std::shared_ptr<Array> values_array;
+  RETURN_NOT_OK(ConcatenateChunks(ctx->memory_pool(), values, &values_array));
+  return Take(ctx, *values_array, indices, options, out);
 }
 
 Status Take(FunctionContext* ctx, const Array& values, const ChunkedArray& indices,
@@ -149,11 +215,13 @@ Status Take(FunctionContext* ctx, const Array& values, const ChunkedArray& indic
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
 
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &new_chunks[i]));
-  }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, options.use_threads, num_chunks, [&](FunctionContext* ctx, int64_t i) {
+        // Take with that indices chunk
+        return Take(ctx, values, *indices.chunk(static_cast<int>(i)), options,
+                    &new_chunks[i]);
+      }));
+  *out = std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   return Status::OK();
 }
 
@@ -164,9 +232,11 @@ Status Take(FunctionContext* ctx, const RecordBatch& batch, const Array& indices
 
   std::vector<std::shared_ptr<Array>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *batch.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, options.use_threads, ncols, [&](FunctionContext* ctx, int64_t j) {
+        return Take(ctx, *batch.column(static_cast<int>(j)), indices, options,
+                    &columns[j]);
+      }));
   *out = RecordBatch::Make(batch.schema(), nrows, columns);
   return Status::OK();
 }
@@ -176,9 +246,11 @@ Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, options.use_threads, ncols, [&](FunctionContext* ctx, int64_t j) {
+        return Take(ctx, *table.column(static_cast<int>(j)), indices, options,
+                    &columns[j]);
+      }));
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
@@ -186,10 +258,32 @@ Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
 Status Take(FunctionContext* ctx, const Table& table, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<Table>* out) {
   auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+  auto num_chunks = indices.num_chunks();
 
+  // Concatenate the chunks of each column, then take from each column with
+  // each chunk of indices
+  std::vector<std::shared_ptr<Array>> values(ncols);
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, options.use_threads, ncols, [&](FunctionContext* ctx, int64_t j) {
+        return ConcatenateChunks(ctx->memory_pool(), *table.column(static_cast<int>(j)),
+                                 &values[j]);
+      }));
+
+  std::vector<std::vector<std::shared_ptr<Array>>> new_chunks(
+      ncols, std::vector<std::shared_ptr<Array>>(num_chunks));
+  RETURN_NOT_OK(detail::RunTasks(ctx, options.use_threads,
+                                 static_cast<int64_t>(ncols) * num_chunks,
+                                 [&](FunctionContext* ctx, int64_t task) {
+                                   const int64_t j = task / num_chunks;
+                                   const int i = static_cast<int>(task % num_chunks);
+                                   return Take(ctx, *values[j], *indices.chunk(i),
+                                               options, &new_chunks[j][i]);
+                                 }));
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
   for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
+    columns[j] = std::make_shared<ChunkedArray>(std::move(new_chunks[j]),
+                                                table.schema()->field(j)->type());
   }
   *out = Table::Make(table.schema(), columns);
   return Status::OK();
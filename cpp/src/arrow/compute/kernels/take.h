@@ -31,7 +31,11 @@ namespace compute {
 
 class FunctionContext;
 
-struct ARROW_EXPORT TakeOptions {};
+struct ARROW_EXPORT TakeOptions {
+  /// Whether to take from the columns of tables and record batches, and from
+  /// the chunks of chunked indices, in parallel on the CPU thread pool
+  bool use_threads = false;
+};
 
 /// \brief Take from an array of values at indices in another array
 ///
@@ -207,6 +211,14 @@ class ARROW_EXPORT TakeKernel : public BinaryKernel {
   virtual Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
                       std::shared_ptr<Array>* out) = 0;
 
+  /// \brief chunked values implementation, yielding a single array
+  ///
+  /// Indices are resolved to chunks of values once per run of indices into the
+  /// same chunk, unless there are so many runs that concatenating the chunks of
+  /// values and taking from the result is cheaper.
+  virtual Status Take(FunctionContext* ctx, const ChunkedArray& values,
+                      const Array& indices, std::shared_ptr<Array>* out) = 0;
+
  protected:
   std::shared_ptr<DataType> type_;
 };
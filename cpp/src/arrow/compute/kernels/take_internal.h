@@ -18,18 +18,26 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include <immintrin.h>
+#endif
+
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -206,7 +214,8 @@ class RangeIndexSequence {
   int64_t index_ = 0, length_ = -1;
 };
 
-// an IndexSequence which yields the values of an Array of integers
+// an IndexSequence which yields the values of an Array of integers, less a base
+// (the position of the values taken from in a larger sequence of values)
 template <typename IndexType>
 class ArrayIndexSequence {
  public:
@@ -215,23 +224,28 @@ class ArrayIndexSequence {
 
   constexpr ArrayIndexSequence() = default;
 
-  explicit ArrayIndexSequence(const Array& indices)
-      : indices_(&checked_cast<const NumericArray<IndexType>&>(indices)) {}
+  explicit ArrayIndexSequence(const Array& indices, int64_t base = 0)
+      : indices_(&checked_cast<const NumericArray<IndexType>&>(indices)), base_(base) {}
 
   std::pair<int64_t, bool> Next() {
     if (indices_->IsNull(index_)) {
       ++index_;
       return std::make_pair(-1, false);
     }
-    return std::make_pair(indices_->Value(index_++), true);
+    return std::make_pair(static_cast<int64_t>(indices_->Value(index_++)) - base_, true);
   }
 
   int64_t length() const { return indices_->length(); }
 
   int64_t null_count() const { return indices_->null_count(); }
 
+  const NumericArray<IndexType>& indices() const { return *indices_; }
+
+  int64_t base() const { return base_; }
+
  private:
   const NumericArray<IndexType>* indices_ = nullptr;
+  int64_t base_ = 0;
   int64_t index_ = 0;
   bool never_out_of_bounds_ = false;
 };
@@ -270,6 +284,278 @@ class TakerImpl : public Taker<IndexSequence> {
   std::unique_ptr<BuilderType> builder_;
 };
 
+// ----------------------------------------------------------------------
+// Gathering fixed width values
+
+// The unsigned integer of a byte width, as which fixed width values are gathered
+template <int kByteWidth>
+struct GatherWord {};
+
+template <>
+struct GatherWord<1> {
+  using type = uint8_t;
+};
+
+template <>
+struct GatherWord<2> {
+  using type = uint16_t;
+};
+
+template <>
+struct GatherWord<4> {
+  using type = uint32_t;
+};
+
+template <>
+struct GatherWord<8> {
+  using type = uint64_t;
+};
+
+template <typename T>
+using is_gather_type =
+    std::integral_constant<bool, has_c_type<T>::value && !is_boolean_type<T>::value>;
+
+// Write values[indices[i] - base] to out[i] for i in [0, length)
+template <typename Word, typename IndexCType>
+void GatherScalar(const Word* values, const IndexCType* indices, int64_t base,
+                  int64_t length, Word* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = values[static_cast<int64_t>(indices[i]) - base];
+  }
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+
+// As GatherScalar, with AVX2 gather instructions if there are some for the
+// widths of values and indices; returns whether there were
+template <typename Word, typename IndexCType>
+bool GatherAvx2(const Word*, const IndexCType*, int64_t, int64_t, Word*) {
+  return false;
+}
+
+ARROW_TARGET_AVX2 inline bool GatherAvx2(const uint32_t* values, const int32_t* indices,
+                                         int64_t base, int64_t length, uint32_t* out) {
+  const auto* gather_values = reinterpret_cast<const int*>(values);
+  const __m256i bases = _mm256_set1_epi32(static_cast<int32_t>(base));
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i positions = _mm256_sub_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i)), bases);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi32(gather_values, positions, 4));
+  }
+  GatherScalar(values, indices + i, base, length - i, out + i);
+  return true;
+}
+
+ARROW_TARGET_AVX2 inline bool GatherAvx2(const uint64_t* values, const int32_t* indices,
+                                         int64_t base, int64_t length, uint64_t* out) {
+  const auto* gather_values = reinterpret_cast<const long long*>(values);  // NOLINT
+  const __m128i bases = _mm_set1_epi32(static_cast<int32_t>(base));
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m128i positions = _mm_sub_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)), bases);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi64(gather_values, positions, 8));
+  }
+  GatherScalar(values, indices + i, base, length - i, out + i);
+  return true;
+}
+
+ARROW_TARGET_AVX2 inline bool GatherAvx2(const uint32_t* values, const int64_t* indices,
+                                         int64_t base, int64_t length, uint32_t* out) {
+  const auto* gather_values = reinterpret_cast<const int*>(values);
+  const __m256i bases = _mm256_set1_epi64x(base);
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256i positions = _mm256_sub_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i)), bases);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm256_i64gather_epi32(gather_values, positions, 4));
+  }
+  GatherScalar(values, indices + i, base, length - i, out + i);
+  return true;
+}
+
+ARROW_TARGET_AVX2 inline bool GatherAvx2(const uint64_t* values, const int64_t* indices,
+                                         int64_t base, int64_t length, uint64_t* out) {
+  const auto* gather_values = reinterpret_cast<const long long*>(values);  // NOLINT
+  const __m256i bases = _mm256_set1_epi64x(base);
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m256i positions = _mm256_sub_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i)), bases);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i64gather_epi64(gather_values, positions, 8));
+  }
+  GatherScalar(values, indices + i, base, length - i, out + i);
+  return true;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+// The length of the run of consecutive indices starting a strictly increasing
+// sequence of indices, found by galloping
+template <typename IndexCType>
+int64_t ConsecutiveRunLength(const IndexCType* indices, int64_t length) {
+  auto consecutive = [&](int64_t run_length) {
+    return static_cast<int64_t>(indices[run_length - 1]) -
+               static_cast<int64_t>(indices[0]) ==
+           run_length - 1;
+  };
+  // The first lo indices are consecutive, the first hi are not
+  int64_t lo = 1, hi = 2;
+  while (hi <= length && consecutive(hi)) {
+    lo = hi;
+    hi *= 2;
+  }
+  if (hi > length) {
+    if (consecutive(length)) {
+      return length;
+    }
+    hi = length;
+  }
+  while (hi - lo > 1) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    if (consecutive(mid)) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Taking fixed width values gathers them straight into a buffer rather than
+// appending them to a builder. Taking with an array of indices without nulls
+// copies the runs of consecutive indices in sorted indices with memcpy, and
+// otherwise gathers values with AVX2 instructions if the CPU supports them.
+template <typename IndexSequence, typename T>
+class PrimitiveTakerImpl : public Taker<IndexSequence> {
+ public:
+  using Word = typename GatherWord<sizeof(typename T::c_type)>::type;
+
+  using Taker<IndexSequence>::Taker;
+
+  Status SetContext(FunctionContext* ctx) override {
+    values_builder_.reset(new BufferBuilder(ctx->memory_pool()));
+    null_bitmap_builder_.reset(new TypedBufferBuilder<bool>(ctx->memory_pool()));
+    use_avx2_ = ctx->cpu_info()->IsSupported(internal::CpuInfo::AVX2);
+    return Status::OK();
+  }
+
+  Status Take(const Array& values, IndexSequence indices) override {
+    DCHECK(this->type_->Equals(values.type()));
+    RETURN_NOT_OK(values_builder_->Reserve(indices.length() * sizeof(Word)));
+    RETURN_NOT_OK(null_bitmap_builder_->Reserve(indices.length()));
+    return TakeImpl(values, indices);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    const int64_t length = null_bitmap_builder_->length();
+    const int64_t null_count = null_bitmap_builder_->false_count();
+    std::shared_ptr<Buffer> values, null_bitmap;
+    RETURN_NOT_OK(values_builder_->Finish(&values));
+    if (null_count > 0) {
+      RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    } else {
+      null_bitmap_builder_->Reset();
+    }
+    *out = MakeArray(
+        ArrayData::Make(this->type_, length, {null_bitmap, values}, null_count));
+    return Status::OK();
+  }
+
+ private:
+  Word* out_values() {
+    return reinterpret_cast<Word*>(values_builder_->mutable_data() +
+                                   values_builder_->length());
+  }
+
+  // Gather the values one index at a time
+  template <typename Sequence>
+  Status TakeImpl(const Array& values, Sequence indices) {
+    const Word* raw_values = values.data()->GetValues<Word>(1);
+    Word* out = out_values();
+    int64_t position = 0;
+    RETURN_NOT_OK(VisitIndices(indices, values, [&](int64_t index, bool is_valid) {
+      null_bitmap_builder_->UnsafeAppend(is_valid);
+      out[position++] = is_valid ? raw_values[index] : Word(0);
+      return Status::OK();
+    }));
+    values_builder_->UnsafeAdvance(position * sizeof(Word));
+    return Status::OK();
+  }
+
+  template <typename IndexType>
+  Status TakeImpl(const Array& values, ArrayIndexSequence<IndexType> indices) {
+    using IndexCType = typename IndexType::c_type;
+    if (indices.null_count() != 0) {
+      return TakeImpl<ArrayIndexSequence<IndexType>>(values, indices);
+    }
+
+    const IndexCType* raw_indices = indices.indices().raw_values();
+    const int64_t length = indices.length();
+    const int64_t base = indices.base();
+
+    // Bounds check the indices and see if they're sorted
+    const auto num_values = static_cast<uint64_t>(values.length());
+    bool out_of_bounds = false, sorted = true;
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t index = static_cast<int64_t>(raw_indices[i]) - base;
+      out_of_bounds |= static_cast<uint64_t>(index) >= num_values;
+    }
+    for (int64_t i = 1; i < length; ++i) {
+      sorted &= raw_indices[i] > raw_indices[i - 1];
+    }
+    if (out_of_bounds && !indices.never_out_of_bounds()) {
+      return Status::IndexError("take index out of bounds");
+    }
+    DCHECK(!out_of_bounds);
+
+    const Word* raw_values = values.data()->GetValues<Word>(1);
+    Word* out = out_values();
+    if (sorted) {
+      for (int64_t i = 0; i < length;) {
+        const int64_t run_length = ConsecutiveRunLength(raw_indices + i, length - i);
+        const int64_t index = static_cast<int64_t>(raw_indices[i]) - base;
+        if (run_length == 1) {
+          out[i] = raw_values[index];
+        } else {
+          std::memcpy(out + i, raw_values + index, run_length * sizeof(Word));
+        }
+        i += run_length;
+      }
+    } else {
+      bool gathered = false;
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      if (use_avx2_) {
+        gathered = GatherAvx2(raw_values, raw_indices, base, length, out);
+      }
+#endif
+      if (!gathered) {
+        GatherScalar(raw_values, raw_indices, base, length, out);
+      }
+    }
+    values_builder_->UnsafeAdvance(length * sizeof(Word));
+
+    if (values.null_count() == 0) {
+      null_bitmap_builder_->UnsafeAppend(length, true);
+    } else {
+      int64_t i = 0;
+      null_bitmap_builder_->UnsafeAppend<true>(length, [&] {
+        return values.IsValid(static_cast<int64_t>(raw_indices[i++]) - base);
+      });
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<BufferBuilder> values_builder_;
+  std::unique_ptr<TypedBufferBuilder<bool>> null_bitmap_builder_;
+  bool use_avx2_ = false;
+};
+
 // Gathering from NullArrays is trivial; skip the builder and just
 // do bounds checking
 template <typename IndexSequence>
@@ -749,7 +1035,13 @@ class TakerImpl<IndexSequence, ExtensionType> : public Taker<IndexSequence> {
 template <typename IndexSequence>
 struct TakerMakeImpl {
   template <typename T>
-  Status Visit(const T&) {
+  enable_if_t<is_gather_type<T>::value, Status> Visit(const T&) {
+    out_->reset(new PrimitiveTakerImpl<IndexSequence, T>(type_));
+    return (*out_)->Init();
+  }
+
+  template <typename T>
+  enable_if_t<!is_gather_type<T>::value, Status> Visit(const T&) {
     out_->reset(new TakerImpl<IndexSequence, T>(type_));
     return (*out_)->Init();
   }
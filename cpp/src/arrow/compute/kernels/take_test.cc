@@ -182,6 +182,17 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeSortedNumeric) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Numeric<TypeParam>(1000, 0, 127, 0.25);
+  // Runs of consecutive sorted indices are copied at once
+  auto indices = ArrayFromJSON(
+      int32(), "[0, 1, 2, 3, 5, 100, 101, 102, 103, 104, 105, 106, 107, 500, 998, 999]");
+  this->ValidateTake(values, indices);
+  this->ValidateTake(values->Slice(1), indices->Slice(1, 12));
+  this->ValidateTake(values, ArrayFromJSON(int32(), "[0, 1, 2, null, 4, 5, 6]"));
+}
+
 using StringTypes =
     ::testing::Types<BinaryType, StringType, LargeBinaryType, LargeStringType>;
 
@@ -640,6 +651,33 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayRuns) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(1000, 0, 100, 0.1);
+  ChunkedArray chunked(
+      {values->Slice(0, 300), values->Slice(300, 0), values->Slice(300)});
+
+  // A few runs of indices into the same chunk are taken from each chunk, many
+  // are taken from the concatenated chunks
+  auto few_runs = ArrayFromJSON(int32(), "[null, 5, 6, 7, null, 299, 300, 999, 0]");
+  for (auto indices : {few_runs, rand.Int32(500, 0, 999, 0.1)}) {
+    std::shared_ptr<ChunkedArray> actual;
+    ASSERT_OK(
+        arrow::compute::Take(&this->ctx_, chunked, *indices, TakeOptions(), &actual));
+    ASSERT_OK(actual->ValidateFull());
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(
+        arrow::compute::Take(&this->ctx_, *values, *indices, TakeOptions(), &expected));
+    AssertChunkedEqual(ChunkedArray({expected}), *actual);
+  }
+
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_RAISES(IndexError,
+                arrow::compute::Take(&this->ctx_, chunked,
+                                     *ArrayFromJSON(int32(), "[0, 1, 1000]"),
+                                     TakeOptions(), &actual));
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -696,5 +734,38 @@ TEST_F(TestTakeKernelWithTable, TakeTable) {
   this->AssertChunkedTake(schm, table_json, {"[0, 1]", "[2, 3]"}, table_json);
 }
 
+TEST_F(TestTakeKernelWithTable, TakeTableThreaded) {
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto table = TableFromJSON(schm, {R"([{"a": null, "b": "yo"}, {"a": 1, "b": ""}])",
+                                    R"([{"a": 2, "b": "hello"}])",
+                                    R"([{"a": 4, "b": "eh"}, {"a": 5, "b": null}])"});
+
+  TakeOptions options;
+  options.use_threads = true;
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(arrow::compute::Take(&this->ctx_, *table,
+                                 *ArrayFromJSON(int8(), "[4, 2, null, 0]"), options,
+                                 &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*TableFromJSON(schm, {R"([{"a": 5, "b": null},
+                                                {"a": 2, "b": "hello"},
+                                                {"a": null, "b": null},
+                                                {"a": null, "b": "yo"}])"}),
+                      *actual);
+
+  auto indices = ChunkedArrayFromJSON(int8(), {"[4]", "[]", "[2, null, 0]"});
+  ASSERT_OK(arrow::compute::Take(&this->ctx_, *table, *indices, options, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_TABLES_EQUAL(*TableFromJSON(schm, {R"([{"a": 5, "b": null}])", "[]",
+                                            R"([{"a": 2, "b": "hello"},
+                                                {"a": null, "b": null},
+                                                {"a": null, "b": "yo"}])"}),
+                      *actual);
+
+  ASSERT_RAISES(IndexError,
+                arrow::compute::Take(&this->ctx_, *table, *ArrayFromJSON(int8(), "[5]"),
+                                     options, &actual));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,297 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/top_k.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sort_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Move the k entries of [begin, end) ordered first by less to the front, and
+// sort them.  less must be a strict total order.
+template <typename Less>
+void SelectK(int64_t* begin, int64_t* end, int64_t k, Less&& less) {
+  if (end - begin > k) {
+    std::nth_element(begin, begin + k, end, less);
+    end = begin + k;
+  }
+  std::sort(begin, end, less);
+}
+
+Status MakeIndices(FunctionContext* ctx, const int64_t* indices, int64_t length,
+                   std::shared_ptr<Array>* out) {
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(uint64_t), &indices_buf));
+  if (length > 0) {
+    std::memcpy(indices_buf->mutable_data(), indices, length * sizeof(uint64_t));
+  }
+  *out = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+Status SelectKToIndices(FunctionContext* ctx, const Array& values, int64_t k,
+                        SortKey::Order order, std::shared_ptr<Array>* offsets) {
+  if (k < 0) {
+    return Status::Invalid("Number of values to select must be non-negative, got ", k);
+  }
+  std::unique_ptr<detail::ColumnComparator> comparator;
+  RETURN_NOT_OK(detail::ColumnComparator::Make(values.type(), SortKey("", order),
+                                               &comparator));
+
+  std::vector<int64_t> indices(values.length());
+  std::iota(indices.begin(), indices.end(), 0);
+  SelectK(indices.data(), indices.data() + indices.size(), k,
+          [&](int64_t left, int64_t right) {
+            const int result = comparator->Compare(values, left, values, right);
+            return result != 0 ? result < 0 : left < right;
+          });
+  return MakeIndices(ctx, indices.data(), std::min(k, values.length()), offsets);
+}
+
+class TopKSelectorImpl : public TopKSelector {
+ public:
+  TopKSelectorImpl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                   int64_t k)
+      : ctx_(ctx), schema_(schema), k_(k) {}
+
+  Status Init(const std::vector<SortKey>& keys) {
+    if (k_ < 0) {
+      return Status::Invalid("Number of rows to select must be non-negative, got ", k_);
+    }
+    if (keys.empty()) {
+      return Status::Invalid("Must specify at least one sort key");
+    }
+    for (const auto& key : keys) {
+      int index = schema_->GetFieldIndex(key.name);
+      if (index < 0) {
+        return Status::Invalid("No unique column named '", key.name, "' in schema ",
+                               *schema_);
+      }
+      std::unique_ptr<detail::ColumnComparator> comparator;
+      RETURN_NOT_OK(detail::ColumnComparator::Make(schema_->field(index)->type(), key,
+                                                   &comparator));
+      key_indices_.push_back(index);
+      comparators_.push_back(std::move(comparator));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema ", *batch.schema(),
+                             " does not match selector schema ", *schema_);
+    }
+    const int64_t length = batch.num_rows();
+    std::vector<int64_t> selected;
+    if (candidates_ != nullptr && candidates_->num_rows() == k_) {
+      // Only rows sorting strictly before the k-th candidate can make it, as
+      // the candidate comes first in the stream
+      const int64_t last = k_ - 1;
+      const auto batch_keys = KeyColumns(batch);
+      const auto candidate_keys = KeyColumns(*candidates_);
+      for (int64_t i = 0; i < length; i++) {
+        if (CompareRows(batch_keys, i, candidate_keys, last) < 0) {
+          selected.push_back(i);
+        }
+      }
+    } else if (k_ > 0) {
+      selected.resize(length);
+      std::iota(selected.begin(), selected.end(), 0);
+    }
+
+    if (!selected.empty()) {
+      Pending pending;
+      if (static_cast<int64_t>(selected.size()) == length) {
+        pending.batch = RecordBatch::Make(batch.schema(), length, batch.columns());
+      } else {
+        std::shared_ptr<Array> indices;
+        RETURN_NOT_OK(MakeIndices(ctx_, selected.data(), selected.size(), &indices));
+        RETURN_NOT_OK(Take(ctx_, batch, *indices, TakeOptions(), &pending.batch));
+      }
+      for (int64_t i : selected) {
+        pending.sequence.push_back(num_rows_seen_ + i);
+      }
+      num_pending_rows_ += static_cast<int64_t>(selected.size());
+      pending_.push_back(std::move(pending));
+    }
+    num_rows_seen_ += length;
+
+    // Keep the buffered rows bounded
+    if (num_pending_rows_ >= k_ && num_pending_rows_ > 0) {
+      RETURN_NOT_OK(SelectCandidates());
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) override {
+    if (!pending_.empty()) {
+      RETURN_NOT_OK(SelectCandidates());
+    }
+    if (candidates_ == nullptr) {
+      std::vector<std::shared_ptr<Array>> columns;
+      for (const auto& field : schema_->fields()) {
+        std::shared_ptr<Array> column;
+        RETURN_NOT_OK(MakeArrayOfNull(field->type(), 0, &column));
+        columns.push_back(std::move(column));
+      }
+      *out = RecordBatch::Make(schema_, 0, std::move(columns));
+      return Status::OK();
+    }
+    *out = candidates_;
+    return Status::OK();
+  }
+
+ private:
+  struct Pending {
+    std::shared_ptr<RecordBatch> batch;
+    // Position of each row in the stream
+    std::vector<int64_t> sequence;
+  };
+
+  std::vector<std::shared_ptr<Array>> KeyColumns(const RecordBatch& batch) const {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int index : key_indices_) {
+      columns.push_back(batch.column(index));
+    }
+    return columns;
+  }
+
+  int CompareRows(const std::vector<std::shared_ptr<Array>>& left, int64_t left_index,
+                  const std::vector<std::shared_ptr<Array>>& right,
+                  int64_t right_index) const {
+    for (size_t i = 0; i < comparators_.size(); i++) {
+      const int result =
+          comparators_[i]->Compare(*left[i], left_index, *right[i], right_index);
+      if (result != 0) {
+        return result;
+      }
+    }
+    return 0;
+  }
+
+  // Select the first k of the candidates and the pending rows as the new
+  // candidates, by a partition around the k-th row
+  Status SelectCandidates() {
+    if (candidates_ != nullptr) {
+      pending_.insert(pending_.begin(), Pending{candidates_, std::move(sequence_)});
+    }
+    std::shared_ptr<RecordBatch> all;
+    std::vector<int64_t> sequence;
+    RETURN_NOT_OK(ConcatenatePending(&all, &sequence));
+    pending_.clear();
+    num_pending_rows_ = 0;
+
+    std::vector<int64_t> indices(all->num_rows());
+    std::iota(indices.begin(), indices.end(), 0);
+    const auto keys = KeyColumns(*all);
+    SelectK(indices.data(), indices.data() + indices.size(), k_,
+            [&](int64_t left, int64_t right) {
+              const int result = CompareRows(keys, left, keys, right);
+              return result != 0 ? result < 0 : sequence[left] < sequence[right];
+            });
+    indices.resize(std::min<int64_t>(k_, indices.size()));
+
+    std::shared_ptr<Array> take_indices;
+    RETURN_NOT_OK(MakeIndices(ctx_, indices.data(), indices.size(), &take_indices));
+    RETURN_NOT_OK(Take(ctx_, *all, *take_indices, TakeOptions(), &candidates_));
+    sequence_.clear();
+    for (int64_t index : indices) {
+      sequence_.push_back(sequence[index]);
+    }
+    return Status::OK();
+  }
+
+  Status ConcatenatePending(std::shared_ptr<RecordBatch>* out,
+                            std::vector<int64_t>* sequence) {
+    int64_t length = 0;
+    for (auto& pending : pending_) {
+      length += pending.batch->num_rows();
+      sequence->insert(sequence->end(), pending.sequence.begin(),
+                       pending.sequence.end());
+    }
+    if (pending_.size() == 1) {
+      *out = pending_[0].batch;
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < schema_->num_fields(); i++) {
+      ArrayVector chunks;
+      for (const auto& pending : pending_) {
+        chunks.push_back(pending.batch->column(i));
+      }
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(Concatenate(chunks, ctx_->memory_pool(), &column));
+      columns.push_back(std::move(column));
+    }
+    *out = RecordBatch::Make(schema_, length, std::move(columns));
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  const int64_t k_;
+  std::vector<int> key_indices_;
+  std::vector<std::unique_ptr<detail::ColumnComparator>> comparators_;
+
+  // The first k rows of the stream up to the last selection, sorted
+  std::shared_ptr<RecordBatch> candidates_;
+  std::vector<int64_t> sequence_;
+  // Rows consumed since the last selection which may make it
+  std::vector<Pending> pending_;
+  int64_t num_pending_rows_ = 0;
+  int64_t num_rows_seen_ = 0;
+};
+
+}  // namespace
+
+Status TopK(FunctionContext* ctx, const Array& values, int64_t k,
+            std::shared_ptr<Array>* offsets) {
+  return SelectKToIndices(ctx, values, k, SortKey::DESCENDING, offsets);
+}
+
+Status BottomK(FunctionContext* ctx, const Array& values, int64_t k,
+               std::shared_ptr<Array>* offsets) {
+  return SelectKToIndices(ctx, values, k, SortKey::ASCENDING, offsets);
+}
+
+Status TopKSelector::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                          int64_t k, const std::vector<SortKey>& keys,
+                          std::unique_ptr<TopKSelector>* out) {
+  std::unique_ptr<TopKSelectorImpl> impl(new TopKSelectorImpl(ctx, schema, k));
+  RETURN_NOT_OK(impl->Init(keys));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
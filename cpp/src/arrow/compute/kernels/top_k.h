@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Returns the indices of the k largest values of an array, sorted.
+///
+/// Runs in time linear in the length of the array, plus O(k log k) to sort
+/// the selected values.  NaNs are selected after all other values and nulls
+/// last, equal values are selected in order of index.  If the array has fewer
+/// than k values, all are selected.
+///
+/// For example given values = [5, null, 1, 7, 5] and k = 3, the output will
+/// be [3, 0, 4]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] k number of values to select
+/// \param[out] offsets uint64 indices of the selected values, largest first
+ARROW_EXPORT
+Status TopK(FunctionContext* ctx, const Array& values, int64_t k,
+            std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k smallest values of an array, sorted.
+///
+/// Same as TopK, the smallest value first.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] k number of values to select
+/// \param[out] offsets uint64 indices of the selected values, smallest first
+ARROW_EXPORT
+Status BottomK(FunctionContext* ctx, const Array& values, int64_t k,
+               std::shared_ptr<Array>* offsets);
+
+/// \brief Keeps the first k rows, in the order of some sort keys, of a
+/// stream of record batches
+///
+/// Only k candidate rows are kept between batches, plus the rows of the
+/// batches consumed since candidates were last selected.  Rows of a new
+/// batch not sorting before the k-th candidate are discarded as soon as the
+/// batch is consumed.  Rows with equal keys are selected in stream order.
+///
+/// For example "top 100 by revenue" is a selector for k = 100 and keys =
+/// [("revenue", DESCENDING)].
+///
+/// \note API not yet finalized
+class ARROW_EXPORT TopKSelector {
+ public:
+  virtual ~TopKSelector() = default;
+
+  /// \brief Consume a record batch of the stream
+  virtual Status Consume(const RecordBatch& batch) = 0;
+
+  /// \brief Return the selected rows, sorted
+  virtual Status Finish(std::shared_ptr<RecordBatch>* out) = 0;
+
+  /// \brief factory for TopKSelector
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] schema the schema of the consumed record batches
+  /// \param[in] k number of rows to select
+  /// \param[in] keys columns to sort by, most significant first
+  /// \param[out] out created selector
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     int64_t k, const std::vector<SortKey>& keys,
+                     std::unique_ptr<TopKSelector>* out);
+};
+
+}  // namespace compute
+}  // namespace arrow
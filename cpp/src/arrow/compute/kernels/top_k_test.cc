@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/top_k.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+class TestTopK : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const std::shared_ptr<DataType>& type, const std::string& values,
+                  int64_t k, const std::string& expected_top,
+                  const std::string& expected_bottom) {
+    auto array = ArrayFromJSON(type, values);
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopK(&this->ctx_, *array, k, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected_top), *actual);
+    ASSERT_OK(BottomK(&this->ctx_, *array, k, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected_bottom), *actual);
+  }
+};
+
+TEST_F(TestTopK, Array) {
+  this->AssertTopK(int32(), "[]", 3, "[]", "[]");
+  this->AssertTopK(int32(), "[5, null, 1, 7, 5]", 0, "[]", "[]");
+  this->AssertTopK(int32(), "[5, null, 1, 7, 5]", 3, "[3, 0, 4]", "[2, 0, 4]");
+  this->AssertTopK(int32(), "[5, null, 1, 7, 5]", 10, "[3, 0, 4, 2, 1]",
+                   "[2, 0, 4, 3, 1]");
+  this->AssertTopK(float64(), "[0.5, -1.5, 2.5, null]", 2, "[2, 0]", "[1, 0]");
+  this->AssertTopK(utf8(), R"(["b", "a", "c", "a"])", 2, "[2, 0]", "[1, 3]");
+  // NaNs are selected after all other values, before nulls
+  this->AssertTopK(float64(), "[3, NaN, 1]", 2, "[0, 2]", "[2, 0]");
+  this->AssertTopK(float64(), "[3, NaN, 1, null, NaN, 2]", 3, "[0, 5, 2]", "[2, 5, 0]");
+  this->AssertTopK(float64(), "[3, NaN, 1, null, NaN, 2]", 10, "[0, 5, 2, 1, 4, 3]",
+                   "[2, 5, 0, 1, 4, 3]");
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, TopK(&this->ctx_, *ArrayFromJSON(int8(), "[1]"), -1, &out));
+  ASSERT_RAISES(NotImplemented,
+                TopK(&this->ctx_, *ArrayFromJSON(boolean(), "[true]"), 1, &out));
+}
+
+TEST_F(TestTopK, Selector) {
+  auto schm = schema({field("g", utf8()), field("revenue", int64())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schm, 3,
+                               {{"revenue", SortKey::DESCENDING}, {"g"}}, &selector));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schm, R"([
+    {"g": "a", "revenue": 10},
+    {"g": "b", "revenue": null},
+    {"g": "c", "revenue": 30}
+  ])")));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schm, "[]")));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schm, R"([
+    {"g": "d", "revenue": 10},
+    {"g": "a", "revenue": 20},
+    {"g": "e", "revenue": 5}
+  ])")));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schm, R"([
+    {"g": "f", "revenue": 30},
+    {"g": "0", "revenue": 10}
+  ])")));
+
+  std::shared_ptr<RecordBatch> actual;
+  ASSERT_OK(selector->Finish(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(schm, R"([
+    {"g": "c", "revenue": 30},
+    {"g": "f", "revenue": 30},
+    {"g": "a", "revenue": 20}
+  ])"),
+                       *actual);
+
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schm, 5, {{"g"}}, &selector));
+  ASSERT_OK(selector->Finish(&actual));
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(schm, "[]"), *actual);
+}
+
+TEST_F(TestTopK, SelectorNaN) {
+  auto schm = schema({field("g", utf8()), field("x", float64())});
+  const std::vector<std::string> batches = {
+      R"([{"g": "a", "x": 1}, {"g": "b", "x": NaN}, {"g": "c", "x": null}])",
+      R"([{"g": "d", "x": NaN}, {"g": "e", "x": 3}])",
+      R"([{"g": "f", "x": 2}, {"g": "g", "x": NaN}, {"g": "h", "x": 1}])"};
+  const std::vector<std::pair<int64_t, std::string>> cases = {
+      {4, R"(["e", "f", "a", "h"])"},
+      {6, R"(["e", "f", "a", "h", "b", "d"])"},
+      {10, R"(["e", "f", "a", "h", "b", "d", "g", "c"])"}};
+  for (const auto& k_and_expected : cases) {
+    std::unique_ptr<TopKSelector> selector;
+    ASSERT_OK(TopKSelector::Make(&this->ctx_, schm, k_and_expected.first,
+                                 {{"x", SortKey::DESCENDING}}, &selector));
+    for (const auto& batch : batches) {
+      ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schm, batch)));
+    }
+    std::shared_ptr<RecordBatch> actual;
+    ASSERT_OK(selector->Finish(&actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(utf8(), k_and_expected.second), *actual->column(0));
+  }
+}
+
+// The selection over a stream must agree with a sort of the whole stream
+TEST_F(TestTopK, SelectorRandom) {
+  auto schm = schema({field("a", int8()), field("b", float64()), field("c", int32())});
+  std::vector<SortKey> keys = {{"a", SortKey::ASCENDING, SortKey::NULLS_FIRST},
+                               {"b", SortKey::DESCENDING}};
+  random::RandomArrayGenerator generator(0x7070);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 20; i++) {
+    const int64_t length = 50 * i;
+    batches.push_back(RecordBatch::Make(schm, length,
+                                        {generator.Int8(length, 0, 3, 0.1),
+                                         generator.Float64(length, 0, 10, 0.1),
+                                         generator.Int32(length, 0, 1000)}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, keys, &indices));
+
+  for (int64_t k : {1, 10, 100, 1000, 100000}) {
+    std::unique_ptr<TopKSelector> selector;
+    ASSERT_OK(TopKSelector::Make(&this->ctx_, schm, k, keys, &selector));
+    for (const auto& batch : batches) {
+      ASSERT_OK(selector->Consume(*batch));
+    }
+    std::shared_ptr<RecordBatch> actual;
+    ASSERT_OK(selector->Finish(&actual));
+    ASSERT_OK(actual->ValidateFull());
+
+    std::shared_ptr<Table> expected, actual_table;
+    auto expected_indices = indices->Slice(0, std::min(k, table->num_rows()));
+    ASSERT_OK(Take(&this->ctx_, *table, *expected_indices, TakeOptions(), &expected));
+    ASSERT_OK(Table::FromRecordBatches({actual}, &actual_table));
+    AssertTablesEqual(*expected, *actual_table, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestTopK, SelectorErrors) {
+  auto schm = schema({field("a", int32())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_RAISES(Invalid, TopKSelector::Make(&this->ctx_, schm, -1, {{"a"}}, &selector));
+  ASSERT_RAISES(Invalid, TopKSelector::Make(&this->ctx_, schm, 1, {}, &selector));
+  ASSERT_RAISES(Invalid, TopKSelector::Make(&this->ctx_, schm, 1, {{"b"}}, &selector));
+
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schm, 1, {{"a"}}, &selector));
+  ASSERT_RAISES(Invalid, selector->Consume(*RecordBatchFromJSON(
+                             schema({field("a", int64())}), R"([{"a": 1}])")));
+}
+
+}  // namespace compute
+}  // namespace arrow
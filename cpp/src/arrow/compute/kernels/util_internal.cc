@@ -26,9 +26,12 @@
 #include "arrow/array.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -47,24 +50,24 @@ inline void ZeroLastByte(Buffer* buffer) {
   *(buffer->mutable_data() + (buffer->size() - 1)) = 0;
 }
 
+int64_t ValueBufferSize(const DataType& type, int64_t length) {
+  const auto& fw_type = checked_cast<const FixedWidthType&>(type);
+  const int bit_width = fw_type.bit_width();
+  if (bit_width == 1) {
+    return BitUtil::BytesForBits(length);
+  }
+  ARROW_CHECK_EQ(bit_width % 8, 0)
+      << "Only bit widths with multiple of 8 are currently supported";
+  return length * bit_width / 8;
+}
+
 Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t length,
                            std::shared_ptr<Buffer>* buffer) {
   if (type.id() != Type::NA) {
-    const auto& fw_type = checked_cast<const FixedWidthType&>(type);
-
-    int bit_width = fw_type.bit_width();
-    int64_t buffer_size = 0;
-
-    if (bit_width == 1) {
-      buffer_size = BitUtil::BytesForBits(length);
-    } else {
-      ARROW_CHECK_EQ(bit_width % 8, 0)
-          << "Only bit widths with multiple of 8 are currently supported";
-      buffer_size = length * fw_type.bit_width() / 8;
-    }
+    const int64_t buffer_size = ValueBufferSize(type, length);
     RETURN_NOT_OK(ctx->Allocate(buffer_size, buffer));
 
-    if (bit_width == 1 && buffer_size > 0) {
+    if (checked_cast<const FixedWidthType&>(type).bit_width() == 1 && buffer_size > 0) {
       // Some utility methods access the last byte before it might be
       // initialized this makes valgrind/asan unhappy, so we proactively
       // zero it.
@@ -174,6 +177,25 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   return Status::OK();
 }
 
+Status RunTasks(FunctionContext* ctx, bool use_threads, int64_t num_tasks,
+                const std::function<Status(FunctionContext*, int64_t)>& task) {
+  if (!use_threads || num_tasks <= 1) {
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(task(ctx, i));
+    }
+    return Status::OK();
+  }
+  auto task_group = internal::TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+  MemoryPool* pool = ctx->memory_pool();
+  for (int64_t i = 0; i < num_tasks; ++i) {
+    task_group->Append([pool, &task, i] {
+      FunctionContext task_ctx(pool);
+      return task(&task_ctx, i);
+    });
+  }
+  return task_group->Finish();
+}
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays) {
   // Create right kind of datum
@@ -205,6 +227,27 @@ Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums) {
   }
 }
 
+std::shared_ptr<Buffer> GetReusableValueBuffer(const Datum& out, const DataType& type,
+                                               int64_t length) {
+  if (out.kind() != Datum::ARRAY || type.id() == Type::NA ||
+      !is_fixed_width(type.id())) {
+    return nullptr;
+  }
+  // Not Datum::array(), which would add a reference
+  const auto& data = util::get<std::shared_ptr<ArrayData>>(out.value);
+  if (data.use_count() != 1 || data->length != length || data->offset != 0 ||
+      data->buffers.size() != 2 || !data->type->Equals(type)) {
+    return nullptr;
+  }
+  const auto& buffer = data->buffers[1];
+  if (buffer == nullptr || buffer.use_count() != 1 || buffer->parent() != nullptr ||
+      !buffer->is_mutable() || !buffer->is_cpu() ||
+      buffer->size() < ValueBufferSize(type, length)) {
+    return nullptr;
+  }
+  return buffer;
+}
+
 PrimitiveAllocatingUnaryKernel::PrimitiveAllocatingUnaryKernel(UnaryKernel* delegate)
     : delegate_(delegate) {}
 
@@ -302,8 +345,10 @@ Status PrimitiveAllocatingUnaryKernel::Call(FunctionContext* ctx, const Datum& i
   result->buffers.resize(2);
 
   const int64_t length = input.length();
-  // Allocate the value buffer
-  RETURN_NOT_OK(AllocateValueBuffer(ctx, *out_type(), length, &(result->buffers[1])));
+  // Allocate the value buffer, unless one is reused
+  if (result->buffers[1] == nullptr) {
+    RETURN_NOT_OK(AllocateValueBuffer(ctx, *out_type(), length, &(result->buffers[1])));
+  }
   return delegate_->Call(ctx, input, out);
 }
 
@@ -321,9 +366,10 @@ Status PrimitiveAllocatingBinaryKernel::Call(FunctionContext* ctx, const Datum&
   result->buffers.resize(2);
 
   const int64_t length = result->length;
-  RETURN_NOT_OK(AllocateValueBuffer(ctx, *out_type(), length, &(result->buffers[1])));
-
-  // Allocate the value buffer
+  // Allocate the value buffer, unless one is reused
+  if (result->buffers[1] == nullptr) {
+    RETURN_NOT_OK(AllocateValueBuffer(ctx, *out_type(), length, &(result->buffers[1])));
+  }
   return delegate_->Call(ctx, left, right, out);
 }
 
@@ -18,6 +18,9 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -25,6 +28,7 @@
 #include "arrow/buffer.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +48,27 @@ static inline void ZeroCopyData(const ArrayData& input, ArrayData* output) {
 
 namespace detail {
 
+// Load the 64 bits of a bitmap starting at bit_offset, bits past length zeroed
+inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset,
+                               int64_t length) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  if (shift == 0 && length == 64) {
+    std::memcpy(&word, bytes, sizeof(word));
+    return BitUtil::FromLittleEndian(word);
+  }
+  uint8_t buffer[16] = {};
+  std::memcpy(buffer, bytes, BitUtil::BytesForBits(shift + length));
+  uint64_t low, high;
+  std::memcpy(&low, buffer, sizeof(low));
+  std::memcpy(&high, buffer + sizeof(low), sizeof(high));
+  low = BitUtil::FromLittleEndian(low);
+  high = BitUtil::FromLittleEndian(high);
+  word = shift == 0 ? low : (low >> shift) | (high << (64 - shift));
+  return length == 64 ? word : word & ((uint64_t(1) << length) - 1);
+}
+
 /// \brief Invoke the kernel on value using the ctx and store results in outputs.
 ///
 /// \param[in,out] ctx The function context to use when invoking the kernel.
@@ -103,6 +128,16 @@ ARROW_EXPORT
 Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
                               const ArrayData& right, ArrayData* output);
 
+/// \brief Run num_tasks tasks, in parallel on the CPU thread pool if
+/// use_threads
+///
+/// Threaded tasks are given a FunctionContext of their own, allocating from
+/// the memory pool of ctx, since the error status of a context is not
+/// thread-safe.
+ARROW_EXPORT
+Status RunTasks(FunctionContext* ctx, bool use_threads, int64_t num_tasks,
+                const std::function<Status(FunctionContext*, int64_t)>& task);
+
 ARROW_EXPORT
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
@@ -110,9 +145,23 @@ Datum WrapArraysLike(const Datum& value,
 ARROW_EXPORT
 Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums);
 
+/// \brief Return the value buffer of a previous output which a kernel may
+/// write an output of the given fixed-width type and length into, or null
+///
+/// The buffer can be reused if out is an array of that type and length, and
+/// neither its data nor its value buffer is referenced elsewhere: nobody else
+/// can observe the values being overwritten.  Reusing the output of the
+/// previous batch saves allocating one per kernel call.
+ARROW_EXPORT
+std::shared_ptr<Buffer> GetReusableValueBuffer(const Datum& out, const DataType& type,
+                                               int64_t length);
+
 /// \brief Kernel used to preallocate outputs for primitive types. This
 /// does not include allocations for the validity bitmap (PropagateNulls
 /// should be used for that).
+///
+/// If the output already has a value buffer, e.g. one returned by
+/// GetReusableValueBuffer, the delegate writes into it instead.
 class ARROW_EXPORT PrimitiveAllocatingUnaryKernel : public UnaryKernel {
  public:
   // \brief Construct with a delegate that must live longer
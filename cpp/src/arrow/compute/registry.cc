@@ -0,0 +1,300 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/registry.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/compute/registry_internal.h"
+#include "arrow/type.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::CpuInfo;
+
+namespace compute {
+
+bool IsSimdLevelSupported(SimdLevel level, const CpuInfo& cpu_info) {
+  switch (level) {
+    case SimdLevel::NONE:
+      return true;
+    case SimdLevel::AVX2:
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      return cpu_info.IsSupported(CpuInfo::AVX2);
+#else
+      return false;
+#endif
+    case SimdLevel::AVX512:
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      return cpu_info.IsSupported(CpuInfo::AVX512);
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+namespace {
+
+struct KernelImpl {
+  std::vector<Type::type> in_types;
+  SimdLevel simd_level;
+  FunctionRegistry::KernelFactory factory;
+
+  bool Matches(const std::vector<std::shared_ptr<DataType>>& types) const {
+    return std::equal(in_types.begin(), in_types.end(), types.begin(),
+                      [](Type::type id, const std::shared_ptr<DataType>& type) {
+                        return id == type->id();
+                      });
+  }
+};
+
+std::string TypesToString(const std::vector<std::shared_ptr<DataType>>& types) {
+  std::stringstream ss;
+  ss << "(";
+  for (size_t i = 0; i < types.size(); ++i) {
+    ss << (i > 0 ? ", " : "") << *types[i];
+  }
+  ss << ")";
+  return ss.str();
+}
+
+// Whether a buffer is the value buffer of an input
+bool IsInputBuffer(const std::shared_ptr<Buffer>& buffer, const Datum& input) {
+  if (!input.is_array()) {
+    return false;
+  }
+  const auto& buffers = input.array()->buffers;
+  return buffers.size() > 1 && buffers[1] == buffer;
+}
+
+// Registered kernels checking their inputs and allocating their output, or
+// reusing the value buffer of the previous one, before delegating to a kernel
+// computing into preallocated primitive output
+
+class AllocatingUnaryKernel : public UnaryKernel {
+ public:
+  AllocatingUnaryKernel(std::shared_ptr<UnaryKernel> delegate, bool in_place)
+      : delegate_(std::move(delegate)), in_place_(in_place) {}
+
+  std::shared_ptr<DataType> out_type() const override { return delegate_->out_type(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    if (!input.is_array()) {
+      return Status::Invalid("Unary kernels expect an array");
+    }
+    auto result = ArrayData::Make(out_type(), input.length(), {nullptr, nullptr});
+    auto buffer = detail::GetReusableValueBuffer(*out, *result->type, result->length);
+    if (in_place_ || !IsInputBuffer(buffer, input)) {
+      result->buffers[1] = std::move(buffer);
+    }
+    // Out may be the input, so it is only assigned once the kernel is done
+    Datum result_datum(std::move(result));
+    RETURN_NOT_OK(detail::PrimitiveAllocatingUnaryKernel(delegate_.get())
+                      .Call(ctx, input, &result_datum));
+    *out = std::move(result_datum);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<UnaryKernel> delegate_;
+  bool in_place_;
+};
+
+class AllocatingBinaryKernel : public BinaryKernel {
+ public:
+  AllocatingBinaryKernel(std::shared_ptr<BinaryKernel> delegate, bool in_place)
+      : delegate_(std::move(delegate)), in_place_(in_place) {}
+
+  std::shared_ptr<DataType> out_type() const override { return delegate_->out_type(); }
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const bool left_ok = left.is_array() || left.is_scalar();
+    const bool right_ok = right.is_array() || right.is_scalar();
+    if (!left_ok || !right_ok || (left.is_scalar() && right.is_scalar())) {
+      return Status::Invalid("Binary kernels expect an array, and an array or a scalar");
+    }
+    if (left.is_array() && right.is_array() && left.length() != right.length()) {
+      return Status::Invalid("Binary kernels expect arrays with the same length");
+    }
+    const int64_t length = left.is_array() ? left.length() : right.length();
+    auto result = ArrayData::Make(out_type(), length, {nullptr, nullptr});
+    auto buffer = detail::GetReusableValueBuffer(*out, *result->type, length);
+    if (in_place_ || (!IsInputBuffer(buffer, left) && !IsInputBuffer(buffer, right))) {
+      result->buffers[1] = std::move(buffer);
+    }
+    // Out may be one of the inputs, so it is only assigned once the kernel is done
+    Datum result_datum(std::move(result));
+    RETURN_NOT_OK(detail::PrimitiveAllocatingBinaryKernel(delegate_.get())
+                      .Call(ctx, left, right, &result_datum));
+    *out = std::move(result_datum);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<BinaryKernel> delegate_;
+  bool in_place_;
+};
+
+}  // namespace
+
+namespace detail {
+
+std::shared_ptr<OpKernel> MakeAllocatingKernel(std::shared_ptr<UnaryKernel> kernel,
+                                               bool in_place) {
+  return std::make_shared<AllocatingUnaryKernel>(std::move(kernel), in_place);
+}
+
+std::shared_ptr<OpKernel> MakeAllocatingKernel(std::shared_ptr<BinaryKernel> kernel,
+                                               bool in_place) {
+  return std::make_shared<AllocatingBinaryKernel>(std::move(kernel), in_place);
+}
+
+}  // namespace detail
+
+class FunctionRegistry::Impl {
+ public:
+  Status AddKernel(const std::string& name, std::vector<Type::type> in_types,
+                   KernelFactory factory, SimdLevel simd_level) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& impls = functions_[name];
+    for (const auto& impl : impls) {
+      if (impl.in_types == in_types && impl.simd_level == simd_level) {
+        return Status::KeyError("Kernel already registered for function '", name,
+                                "' with the same input types and SIMD level");
+      }
+    }
+    impls.push_back({std::move(in_types), simd_level, std::move(factory)});
+    return Status::OK();
+  }
+
+  Status GetKernel(FunctionContext* ctx, const std::string& name,
+                   const std::vector<std::shared_ptr<DataType>>& in_types,
+                   std::shared_ptr<OpKernel>* out) const {
+    for (const auto& type : in_types) {
+      if (type == nullptr) {
+        return Status::Invalid("Input types of function '", name, "' must not be null");
+      }
+    }
+    FunctionRegistry::KernelFactory factory;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = functions_.find(name);
+      if (it == functions_.end()) {
+        return Status::KeyError("No function registered with name '", name, "'");
+      }
+      const KernelImpl* best = nullptr;
+      for (const auto& impl : it->second) {
+        if (impl.in_types.size() != in_types.size() || !impl.Matches(in_types) ||
+            !IsSimdLevelSupported(impl.simd_level, *ctx->cpu_info())) {
+          continue;
+        }
+        if (best == nullptr || impl.simd_level > best->simd_level) {
+          best = &impl;
+        }
+      }
+      if (best == nullptr) {
+        return Status::NotImplemented("Function '", name, "' has no kernel for types ",
+                                      TypesToString(in_types));
+      }
+      factory = best->factory;
+    }
+    return factory(in_types, out);
+  }
+
+  std::vector<std::string> GetFunctionNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (const auto& function : functions_) {
+      names.push_back(function.first);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::vector<KernelImpl>> functions_;
+};
+
+FunctionRegistry::FunctionRegistry() : impl_(new Impl()) {}
+
+FunctionRegistry::~FunctionRegistry() {}
+
+FunctionRegistry* FunctionRegistry::GetInstance() {
+  static std::unique_ptr<FunctionRegistry> registry = []() {
+    std::unique_ptr<FunctionRegistry> builtin(new FunctionRegistry());
+    DCHECK_OK(detail::RegisterArithmeticKernels(builtin.get()));
+    DCHECK_OK(detail::RegisterCompareKernels(builtin.get()));
+    return builtin;
+  }();
+  return registry.get();
+}
+
+Status FunctionRegistry::AddKernel(const std::string& name,
+                                   std::vector<Type::type> in_types,
+                                   KernelFactory factory, SimdLevel simd_level) {
+  return impl_->AddKernel(name, std::move(in_types), std::move(factory), simd_level);
+}
+
+Status FunctionRegistry::GetKernel(FunctionContext* ctx, const std::string& name,
+                                   const std::vector<std::shared_ptr<DataType>>& in_types,
+                                   std::shared_ptr<OpKernel>* out) const {
+  return impl_->GetKernel(ctx, name, in_types, out);
+}
+
+Status FunctionRegistry::GetUnaryKernel(FunctionContext* ctx, const std::string& name,
+                                        const std::shared_ptr<DataType>& in_type,
+                                        std::shared_ptr<UnaryKernel>* out) const {
+  std::shared_ptr<OpKernel> kernel;
+  RETURN_NOT_OK(GetKernel(ctx, name, {in_type}, &kernel));
+  *out = std::dynamic_pointer_cast<UnaryKernel>(kernel);
+  if (*out == nullptr) {
+    return Status::TypeError("Kernel of function '", name, "' is not unary");
+  }
+  return Status::OK();
+}
+
+Status FunctionRegistry::GetBinaryKernel(FunctionContext* ctx, const std::string& name,
+                                         const std::shared_ptr<DataType>& left_type,
+                                         const std::shared_ptr<DataType>& right_type,
+                                         std::shared_ptr<BinaryKernel>* out) const {
+  std::shared_ptr<OpKernel> kernel;
+  RETURN_NOT_OK(GetKernel(ctx, name, {left_type, right_type}, &kernel));
+  *out = std::dynamic_pointer_cast<BinaryKernel>(kernel);
+  if (*out == nullptr) {
+    return Status::TypeError("Kernel of function '", name, "' is not binary");
+  }
+  return Status::OK();
+}
+
+std::vector<std::string> FunctionRegistry::GetFunctionNames() const {
+  return impl_->GetFunctionNames();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_REGISTRY_H
+#define ARROW_COMPUTE_REGISTRY_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace internal {
+class CpuInfo;
+}  // namespace internal
+
+namespace compute {
+
+class BinaryKernel;
+class FunctionContext;
+class OpKernel;
+class UnaryKernel;
+
+/// \brief The instruction set extensions a kernel implementation requires
+enum class SimdLevel : int8_t { NONE = 0, AVX2, AVX512 };
+
+/// \brief Whether kernels of a SIMD level were built and can run on a CPU
+ARROW_EXPORT
+bool IsSimdLevelSupported(SimdLevel level, const internal::CpuInfo& cpu_info);
+
+/// \brief Registry of kernels by function name and input types
+///
+/// A function, such as "add", can have kernels for any number of input type
+/// signatures, and for each signature implementations requiring different
+/// SIMD levels.  Looking up a kernel picks the implementation with the
+/// highest level supported by the CPU.
+///
+/// Kernels made by the registry are bound to their input types.  Callers
+/// should look a kernel up once and call it on all of their batches, rather
+/// than going through a function like Add which does the lookup on each
+/// call.
+///
+/// Unlike the kernels of functions such as Compare, registered kernels
+/// allocate their output: the out datum is overwritten with a new value.
+/// When the out datum holds the output of a previous call, of the same type
+/// and length and referenced nowhere else, its value buffer is written again
+/// instead, so that a pipeline calling a kernel on batches of the same length
+/// does not allocate for each of them.  Kernels of operations which cannot
+/// fail, such as wrapping arithmetic, also write into an input passed as the
+/// out datum, e.g. kernel->Call(ctx, x, y, &x).
+class ARROW_EXPORT FunctionRegistry {
+ public:
+  /// \brief Make a kernel for the given input types, which match the
+  /// signature the factory was registered for
+  using KernelFactory =
+      std::function<Status(const std::vector<std::shared_ptr<DataType>>& in_types,
+                           std::shared_ptr<OpKernel>* out)>;
+
+  FunctionRegistry();
+  ~FunctionRegistry();
+
+  /// \brief The registry of the kernels built into this library
+  static FunctionRegistry* GetInstance();
+
+  /// \brief Register a kernel implementation
+  ///
+  /// \param[in] name the function name
+  /// \param[in] in_types the ids of the input types
+  /// \param[in] factory makes the kernels of the implementation
+  /// \param[in] simd_level the instruction set extensions the kernels use
+  /// \return KeyError if an implementation was already registered for the
+  /// same function, input types and SIMD level
+  Status AddKernel(const std::string& name, std::vector<Type::type> in_types,
+                   KernelFactory factory, SimdLevel simd_level = SimdLevel::NONE);
+
+  /// \brief Make a kernel of a function for the given input types
+  ///
+  /// \param[in] ctx the FunctionContext, whose CpuInfo decides the SIMD level
+  /// \param[in] name the function name
+  /// \param[in] in_types the input types
+  /// \param[out] out the kernel
+  /// \return KeyError if the function is unknown, NotImplemented if it has no
+  /// implementation for the input types
+  Status GetKernel(FunctionContext* ctx, const std::string& name,
+                   const std::vector<std::shared_ptr<DataType>>& in_types,
+                   std::shared_ptr<OpKernel>* out) const;
+
+  /// \brief Make a kernel of a unary function, see GetKernel
+  Status GetUnaryKernel(FunctionContext* ctx, const std::string& name,
+                        const std::shared_ptr<DataType>& in_type,
+                        std::shared_ptr<UnaryKernel>* out) const;
+
+  /// \brief Make a kernel of a binary function, see GetKernel
+  Status GetBinaryKernel(FunctionContext* ctx, const std::string& name,
+                         const std::shared_ptr<DataType>& left_type,
+                         const std::shared_ptr<DataType>& right_type,
+                         std::shared_ptr<BinaryKernel>* out) const;
+
+  /// \brief The names of the registered functions, sorted
+  std::vector<std::string> GetFunctionNames() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_REGISTRY_H
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+
+class BinaryKernel;
+class FunctionRegistry;
+class OpKernel;
+class UnaryKernel;
+
+namespace detail {
+
+// Adapt a kernel computing into a preallocated primitive output, like the
+// delegates of PrimitiveAllocating{Unary,Binary}Kernel, into a registered
+// kernel allocating its output, or reusing the value buffer of the previous
+// output (see GetReusableValueBuffer).
+//
+// If in_place, the kernel may also write into the value buffer of an input
+// which is passed as the output: it must then never fail, since it could not
+// leave its input untouched.
+std::shared_ptr<OpKernel> MakeAllocatingKernel(std::shared_ptr<UnaryKernel> kernel,
+                                               bool in_place = false);
+std::shared_ptr<OpKernel> MakeAllocatingKernel(std::shared_ptr<BinaryKernel> kernel,
+                                               bool in_place = false);
+
+// Register the kernels of a family of functions into the default registry
+Status RegisterArithmeticKernels(FunctionRegistry* registry);
+Status RegisterCompareKernels(FunctionRegistry* registry);
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
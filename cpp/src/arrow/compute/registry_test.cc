@@ -0,0 +1,250 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/registry.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+using internal::CpuInfo;
+
+// Outputs the SIMD level it was registered for
+class LevelKernel : public UnaryKernel {
+ public:
+  explicit LevelKernel(SimdLevel level) : level_(level) {}
+
+  std::shared_ptr<DataType> out_type() const override { return int8(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    *out = Datum(static_cast<int8_t>(level_));
+    return Status::OK();
+  }
+
+ private:
+  SimdLevel level_;
+};
+
+FunctionRegistry::KernelFactory LevelKernelFactory(SimdLevel level) {
+  return [level](const std::vector<std::shared_ptr<DataType>>& in_types,
+                 std::shared_ptr<OpKernel>* out) {
+    *out = std::make_shared<LevelKernel>(level);
+    return Status::OK();
+  };
+}
+
+// The SIMD level of the kernel of the "level" function
+SimdLevel GetKernelLevel(FunctionContext* ctx, const FunctionRegistry& registry) {
+  std::shared_ptr<UnaryKernel> kernel;
+  ARROW_EXPECT_OK(registry.GetUnaryKernel(ctx, "level", int32(), &kernel));
+  Datum out;
+  ARROW_EXPECT_OK(kernel->Call(ctx, ArrayFromJSON(int32(), "[]"), &out));
+  return static_cast<SimdLevel>(checked_cast<const Int8Scalar&>(*out.scalar()).value);
+}
+
+class TestFunctionRegistry : public ComputeFixture, public TestBase {};
+
+TEST_F(TestFunctionRegistry, Basics) {
+  FunctionRegistry registry;
+  ASSERT_OK(
+      registry.AddKernel("level", {Type::INT32}, LevelKernelFactory(SimdLevel::NONE)));
+  ASSERT_OK(registry.AddKernel("other", {Type::INT32, Type::INT32},
+                               LevelKernelFactory(SimdLevel::NONE)));
+  ASSERT_EQ(std::vector<std::string>({"level", "other"}), registry.GetFunctionNames());
+  ASSERT_EQ(SimdLevel::NONE, GetKernelLevel(&ctx_, registry));
+
+  std::shared_ptr<UnaryKernel> unary;
+  std::shared_ptr<BinaryKernel> binary;
+  ASSERT_RAISES(KeyError, registry.AddKernel("level", {Type::INT32},
+                                             LevelKernelFactory(SimdLevel::NONE)));
+  ASSERT_RAISES(KeyError, registry.GetUnaryKernel(&ctx_, "unknown", int32(), &unary));
+  ASSERT_RAISES(NotImplemented,
+                registry.GetUnaryKernel(&ctx_, "level", int64(), &unary));
+  ASSERT_RAISES(NotImplemented,
+                registry.GetBinaryKernel(&ctx_, "level", int32(), int32(), &binary));
+  ASSERT_RAISES(TypeError,
+                registry.GetBinaryKernel(&ctx_, "other", int32(), int32(), &binary));
+  ASSERT_RAISES(Invalid, registry.GetUnaryKernel(&ctx_, "level", nullptr, &unary));
+}
+
+TEST_F(TestFunctionRegistry, SimdLevels) {
+  FunctionRegistry registry;
+  for (auto level : {SimdLevel::NONE, SimdLevel::AVX2, SimdLevel::AVX512}) {
+    ASSERT_OK(
+        registry.AddKernel("level", {Type::INT32}, LevelKernelFactory(level), level));
+  }
+
+  CpuInfo* cpu_info = ctx_.cpu_info();
+  const bool avx2 = IsSimdLevelSupported(SimdLevel::AVX2, *cpu_info);
+  const bool avx512 = IsSimdLevelSupported(SimdLevel::AVX512, *cpu_info);
+  ASSERT_EQ(avx512 ? SimdLevel::AVX512 : avx2 ? SimdLevel::AVX2 : SimdLevel::NONE,
+            GetKernelLevel(&ctx_, registry));
+
+  if (avx512) {
+    cpu_info->EnableFeature(CpuInfo::AVX512, false);
+    ASSERT_EQ(avx2 ? SimdLevel::AVX2 : SimdLevel::NONE, GetKernelLevel(&ctx_, registry));
+    cpu_info->EnableFeature(CpuInfo::AVX512, true);
+  }
+  if (avx2) {
+    cpu_info->EnableFeature(CpuInfo::AVX2, false);
+    cpu_info->EnableFeature(CpuInfo::AVX512, false);
+    ASSERT_EQ(SimdLevel::NONE, GetKernelLevel(&ctx_, registry));
+    cpu_info->EnableFeature(CpuInfo::AVX2, true);
+    if (avx512) {
+      cpu_info->EnableFeature(CpuInfo::AVX512, true);
+    }
+  }
+}
+
+TEST_F(TestFunctionRegistry, BuiltinKernels) {
+  auto registry = FunctionRegistry::GetInstance();
+  auto names = registry->GetFunctionNames();
+  for (const std::string name : {"add", "add_checked", "abs", "equal", "less"}) {
+    ASSERT_NE(names.end(), std::find(names.begin(), names.end(), name)) << name;
+  }
+
+  // A kernel is looked up once, then called on any number of batches
+  std::shared_ptr<BinaryKernel> add;
+  ASSERT_OK(registry->GetBinaryKernel(&ctx_, "add", int32(), int32(), &add));
+  for (int i = 0; i < 3; ++i) {
+    Datum out;
+    ASSERT_OK(add->Call(&ctx_, ArrayFromJSON(int32(), "[1, null, 3]"),
+                        ArrayFromJSON(int32(), "[4, 5, null]"), &out));
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[5, null, null]"), *out.make_array());
+  }
+
+  std::shared_ptr<BinaryKernel> less;
+  ASSERT_OK(registry->GetBinaryKernel(&ctx_, "less", utf8(), utf8(), &less));
+  Datum out;
+  std::shared_ptr<Scalar> b = std::make_shared<StringScalar>("b");
+  ASSERT_OK(less->Call(&ctx_, ArrayFromJSON(utf8(), R"(["a", "c", null])"), Datum(b),
+                       &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null]"), *out.make_array());
+  ASSERT_RAISES(Invalid,
+                less->Call(&ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                           ArrayFromJSON(utf8(), R"(["a", "b"])"), &out));
+
+  ASSERT_RAISES(TypeError,
+                registry->GetBinaryKernel(&ctx_, "less", timestamp(TimeUnit::MILLI),
+                                          timestamp(TimeUnit::NANO), &less));
+  ASSERT_RAISES(NotImplemented,
+                registry->GetBinaryKernel(&ctx_, "add", utf8(), utf8(), &add));
+}
+
+TEST_F(TestFunctionRegistry, ArithmeticSimdLevels) {
+  // All of the implementations of a kernel give the same results
+  CpuInfo* cpu_info = ctx_.cpu_info();
+  const bool avx2 = IsSimdLevelSupported(SimdLevel::AVX2, *cpu_info);
+  const bool avx512 = IsSimdLevelSupported(SimdLevel::AVX512, *cpu_info);
+
+  // Long enough for the vectorized loops, with a null and an overflow
+  auto left = ArrayFromJSON(int16(),
+                            "[1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, "
+                            "17, 18, 19, null, 32767]");
+  auto right = ArrayFromJSON(int16(),
+                             "[1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, "
+                             "17, 18, 19, 20, 1]");
+  auto expected = ArrayFromJSON(int16(),
+                                "[2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, "
+                                "30, 32, 34, 36, 38, null, -32768]");
+  auto check = [&]() {
+    Datum out;
+    ASSERT_OK(Add(&ctx_, left, right, ArithmeticOptions(), &out));
+    AssertArraysEqual(*expected, *out.make_array());
+    ASSERT_RAISES(Invalid, Add(&ctx_, left, right, ArithmeticOptions(true), &out));
+  };
+
+  check();
+  if (avx512) {
+    cpu_info->EnableFeature(CpuInfo::AVX512, false);
+    check();
+  }
+  if (avx2) {
+    cpu_info->EnableFeature(CpuInfo::AVX2, false);
+    check();
+    cpu_info->EnableFeature(CpuInfo::AVX2, true);
+  }
+  if (avx512) {
+    cpu_info->EnableFeature(CpuInfo::AVX512, true);
+  }
+}
+
+TEST_F(TestFunctionRegistry, ReusedOutput) {
+  auto registry = FunctionRegistry::GetInstance();
+  std::shared_ptr<BinaryKernel> add;
+  ASSERT_OK(registry->GetBinaryKernel(&ctx_, "add", int32(), int32(), &add));
+  auto left = ArrayFromJSON(int32(), "[1, null, 3]");
+  auto right = ArrayFromJSON(int32(), "[4, 5, 6]");
+  auto values = [](const Datum& datum) { return datum.array()->buffers[1].get(); };
+
+  // The output of the previous call is written again
+  Datum out;
+  ASSERT_OK(add->Call(&ctx_, left, right, &out));
+  const Buffer* buffer = values(out);
+  ASSERT_OK(add->Call(&ctx_, right, right, &out));
+  ASSERT_EQ(buffer, values(out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[8, 10, 12]"), *out.make_array());
+
+  // ...unless it is referenced elsewhere, or has another length
+  Datum previous = out;
+  ASSERT_OK(add->Call(&ctx_, left, right, &out));
+  ASSERT_NE(values(previous), values(out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[8, 10, 12]"), *previous.make_array());
+  buffer = values(out);
+  ASSERT_OK(add->Call(&ctx_, left->Slice(1), right->Slice(1), &out));
+  ASSERT_NE(buffer, values(out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 9]"), *out.make_array());
+
+  // Operations which cannot fail write into an input passed as the output
+  Datum in_out(ArrayFromJSON(int32(), "[1, 2, 2147483647]")->data());
+  buffer = values(in_out);
+  ASSERT_OK(add->Call(&ctx_, in_out, right, &in_out));
+  ASSERT_EQ(buffer, values(in_out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5, 7, -2147483643]"),
+                    *in_out.make_array());
+
+  // ...others leave their inputs untouched
+  std::shared_ptr<BinaryKernel> add_checked;
+  ASSERT_OK(
+      registry->GetBinaryKernel(&ctx_, "add_checked", int32(), int32(), &add_checked));
+  in_out = ArrayFromJSON(int32(), "[1, 2, 2147483647]")->data();
+  ASSERT_RAISES(Invalid, add_checked->Call(&ctx_, in_out, right, &in_out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 2147483647]"),
+                    *in_out.make_array());
+}
+
+}  // namespace compute
+}  // namespace arrow
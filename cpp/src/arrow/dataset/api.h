@@ -19,6 +19,7 @@
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/discovery.h"
+#include "arrow/dataset/exec_plan.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_ipc.h"
 #include "arrow/dataset/file_parquet.h"
@@ -0,0 +1,641 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_plan.h"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/context.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/task_group.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::TaskGroup;
+
+namespace dataset {
+
+ExecNode::ExecNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                   std::shared_ptr<Schema> output_schema)
+    : plan_(plan), inputs_(std::move(inputs)), output_schema_(std::move(output_schema)) {}
+
+Status ExecNode::StartProducing(TaskGroup*) {
+  return Status::Invalid("ExecNode '", kind_name(), "' is not a source");
+}
+
+Status ExecNode::EmitBatch(std::shared_ptr<RecordBatch> batch) {
+  return output_->InputReceived(this, std::move(batch));
+}
+
+Status ExecNode::EmitFinished() { return output_->InputFinished(this); }
+
+ExecPlan::ExecPlan(std::shared_ptr<ScanContext> context) : context_(std::move(context)) {}
+
+ExecPlan::~ExecPlan() {}
+
+Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(std::shared_ptr<ScanContext> context) {
+  if (context == nullptr) {
+    return Status::Invalid("ExecPlan requires a ScanContext");
+  }
+  return std::shared_ptr<ExecPlan>(new ExecPlan(std::move(context)));
+}
+
+Result<ExecNode*> ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  if (started_) {
+    return Status::Invalid("Cannot add nodes to an ExecPlan which was run");
+  }
+  for (ExecNode* input : node->inputs()) {
+    if (input->plan() != this) {
+      return Status::Invalid("ExecNode '", input->kind_name(),
+                             "' belongs to another ExecPlan");
+    }
+    if (dynamic_cast<SinkNode*>(input) != nullptr) {
+      return Status::Invalid("Sink nodes have no output");
+    }
+    if (input->output() != nullptr) {
+      return Status::Invalid("ExecNode '", input->kind_name(), "' already has an output");
+    }
+  }
+  for (ExecNode* input : node->inputs()) {
+    input->output_ = node.get();
+  }
+  nodes_.push_back(std::move(node));
+  return nodes_.back().get();
+}
+
+Status ExecPlan::Run() {
+  if (started_) {
+    return Status::Invalid("ExecPlan was already run");
+  }
+  started_ = true;
+  for (const auto& node : nodes_) {
+    if (node->output() == nullptr && dynamic_cast<SinkNode*>(node.get()) == nullptr) {
+      return Status::Invalid("ExecNode '", node->kind_name(), "' has no output");
+    }
+  }
+
+  auto task_group = context_->TaskGroup();
+  Status st;
+  for (const auto& node : nodes_) {
+    if (node->inputs().empty()) {
+      st = node->StartProducing(task_group.get());
+      if (!st.ok()) {
+        break;
+      }
+    }
+  }
+  // Wait for the tasks already appended, which reference the nodes
+  Status finished = task_group->Finish();
+  RETURN_NOT_OK(st);
+  return finished;
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Sources
+
+// A source whose batches are produced by tasks, the last task to finish
+// finishing the node.
+class SourceNode : public ExecNode {
+ public:
+  SourceNode(ExecPlan* plan, std::shared_ptr<Schema> output_schema)
+      : ExecNode(plan, {}, std::move(output_schema)) {}
+
+  Status InputReceived(ExecNode*, std::shared_ptr<RecordBatch>) override {
+    return Status::Invalid("Source nodes have no input");
+  }
+
+  Status InputFinished(ExecNode*) override {
+    return Status::Invalid("Source nodes have no input");
+  }
+
+ protected:
+  Status StartProducing(TaskGroup* task_group) override {
+    pending_tasks_.store(1);
+    RETURN_NOT_OK(AppendTasks(task_group));
+    return TaskFinished(task_group);
+  }
+
+  virtual Status AppendTasks(TaskGroup* task_group) = 0;
+
+  // Append a task producing batches
+  void AppendTask(TaskGroup* task_group, std::function<Status()> produce) {
+    pending_tasks_.fetch_add(1);
+    task_group->Append([this, task_group, produce]() {
+      RETURN_NOT_OK(produce());
+      return TaskFinished(task_group);
+    });
+  }
+
+  Status TaskFinished(TaskGroup* task_group) {
+    if (pending_tasks_.fetch_sub(1) == 1 && task_group->ok()) {
+      return EmitFinished();
+    }
+    return Status::OK();
+  }
+
+  std::atomic<int64_t> pending_tasks_{0};
+};
+
+class ScanNode : public SourceNode {
+ public:
+  ScanNode(ExecPlan* plan, std::shared_ptr<Scanner> scanner)
+      : SourceNode(plan, scanner->schema()), scanner_(std::move(scanner)) {}
+
+  const char* kind_name() const override { return "scan"; }
+
+ protected:
+  Status AppendTasks(TaskGroup* task_group) override {
+    ARROW_ASSIGN_OR_RAISE(auto scan_tasks, scanner_->Scan());
+    for (auto maybe_scan_task : scan_tasks) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ScanTask> scan_task,
+                            std::move(maybe_scan_task));
+      AppendTask(task_group, [this, task_group, scan_task]() -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
+        for (auto maybe_batch : batches) {
+          ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+          if (!task_group->ok()) {
+            break;
+          }
+          RETURN_NOT_OK(EmitBatch(std::move(batch)));
+        }
+        return Status::OK();
+      });
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Scanner> scanner_;
+};
+
+class TableSourceNode : public SourceNode {
+ public:
+  TableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table, int64_t morsel_size)
+      : SourceNode(plan, table->schema()),
+        table_(std::move(table)),
+        morsel_size_(morsel_size) {}
+
+  const char* kind_name() const override { return "table_source"; }
+
+ protected:
+  Status AppendTasks(TaskGroup* task_group) override {
+    // Slicing is zero-copy, the morsels are only read by the tasks
+    TableBatchReader reader(*table_);
+    reader.set_chunksize(morsel_size_);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      AppendTask(task_group, [this, batch]() { return EmitBatch(batch); });
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Table> table_;
+  int64_t morsel_size_;
+};
+
+// ----------------------------------------------------------------------
+// Filter and project
+
+class FilterNode : public ExecNode {
+ public:
+  FilterNode(ExecNode* input, std::shared_ptr<Expression> filter)
+      : ExecNode(input->plan(), {input}, input->output_schema()),
+        filter_(std::move(filter)) {}
+
+  const char* kind_name() const override { return "filter"; }
+
+  Status InputReceived(ExecNode*, std::shared_ptr<RecordBatch> batch) override {
+    MemoryPool* pool = plan_->context()->pool;
+    ARROW_ASSIGN_OR_RAISE(auto selection, evaluator_.Evaluate(*filter_, *batch, pool));
+    ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator_.Filter(selection, batch, pool));
+    if (filtered->num_rows() == 0) {
+      return Status::OK();
+    }
+    return EmitBatch(std::move(filtered));
+  }
+
+  Status InputFinished(ExecNode*) override { return EmitFinished(); }
+
+ private:
+  std::shared_ptr<Expression> filter_;
+  TreeEvaluator evaluator_;
+};
+
+class ProjectNode : public ExecNode {
+ public:
+  ProjectNode(ExecNode* input, std::vector<std::shared_ptr<Expression>> expressions,
+              std::shared_ptr<Schema> output_schema)
+      : ExecNode(input->plan(), {input}, std::move(output_schema)),
+        expressions_(std::move(expressions)) {}
+
+  const char* kind_name() const override { return "project"; }
+
+  Status InputReceived(ExecNode*, std::shared_ptr<RecordBatch> batch) override {
+    MemoryPool* pool = plan_->context()->pool;
+    std::vector<std::shared_ptr<Array>> columns(expressions_.size());
+    for (size_t i = 0; i < expressions_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto value,
+                            evaluator_.Evaluate(*expressions_[i], *batch, pool));
+      if (value.is_scalar()) {
+        RETURN_NOT_OK(
+            MakeArrayFromScalar(pool, *value.scalar(), batch->num_rows(), &columns[i]));
+      } else {
+        columns[i] = value.make_array();
+      }
+    }
+    return EmitBatch(
+        RecordBatch::Make(output_schema_, batch->num_rows(), std::move(columns)));
+  }
+
+  Status InputFinished(ExecNode*) override { return EmitFinished(); }
+
+ private:
+  std::vector<std::shared_ptr<Expression>> expressions_;
+  TreeEvaluator evaluator_;
+};
+
+// ----------------------------------------------------------------------
+// Aggregate
+
+class AggregateNode : public ExecNode {
+ public:
+  AggregateNode(ExecNode* input, std::vector<std::string> keys,
+                std::vector<compute::GroupByAggregate> aggregates)
+      : ExecNode(input->plan(), {input}, NULLPTR),
+        pool_(input->plan()->context()->pool),
+        keys_(std::move(keys)),
+        aggregates_(std::move(aggregates)) {}
+
+  // Validates the keys and aggregates, and sets the output schema
+  Status Init() {
+    State state;
+    RETURN_NOT_OK(MakeState(&state));
+    output_schema_ = state.group_by->out_schema();
+    states_.push_back(std::move(state));
+    return Status::OK();
+  }
+
+  const char* kind_name() const override { return "aggregate"; }
+
+  Status InputReceived(ExecNode*, std::shared_ptr<RecordBatch> batch) override {
+    // Take a state no other thread is updating, or make one
+    State state;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!states_.empty()) {
+        state = std::move(states_.back());
+        states_.pop_back();
+      }
+    }
+    if (state.group_by == nullptr) {
+      RETURN_NOT_OK(MakeState(&state));
+    }
+    Status st = state.group_by->Consume(*batch);
+    if (st.ok() && state.ctx->HasError()) {
+      st = state.ctx->status();
+      state.ctx->ResetStatus();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_.push_back(std::move(state));
+    return st;
+  }
+
+  Status InputFinished(ExecNode*) override {
+    // All states were given back by now
+    auto& merged = *states_[0].group_by;
+    for (size_t i = 1; i < states_.size(); ++i) {
+      RETURN_NOT_OK(merged.Merge(states_[i].group_by.get()));
+    }
+    std::shared_ptr<RecordBatch> out;
+    RETURN_NOT_OK(merged.Finish(&out));
+    RETURN_NOT_OK(states_[0].ctx->status());
+    states_.clear();
+    RETURN_NOT_OK(EmitBatch(std::move(out)));
+    return EmitFinished();
+  }
+
+ private:
+  // A HashGroupBy keeps using the context it was made with, and a context
+  // is not thread-safe, so each state has its own
+  struct State {
+    std::unique_ptr<compute::FunctionContext> ctx;
+    std::unique_ptr<compute::HashGroupBy> group_by;
+  };
+
+  Status MakeState(State* out) {
+    out->ctx.reset(new compute::FunctionContext(pool_));
+    return compute::HashGroupBy::Make(out->ctx.get(), inputs_[0]->output_schema(), keys_,
+                                      aggregates_, compute::GroupByOptions(),
+                                      &out->group_by);
+  }
+
+  MemoryPool* pool_;
+  std::vector<std::string> keys_;
+  std::vector<compute::GroupByAggregate> aggregates_;
+
+  std::mutex mutex_;
+  std::vector<State> states_;
+};
+
+// ----------------------------------------------------------------------
+// Hash join
+
+Status ConcatenateBatches(const std::shared_ptr<Schema>& schema,
+                          const std::vector<std::shared_ptr<RecordBatch>>& batches,
+                          MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (batches.size() == 1) {
+      columns[i] = batches[0]->column(i);
+    } else if (batches.empty()) {
+      RETURN_NOT_OK(MakeArrayOfNull(pool, schema->field(i)->type(), 0, &columns[i]));
+    } else {
+      ArrayVector chunks;
+      for (const auto& batch : batches) {
+        chunks.push_back(batch->column(i));
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool, &columns[i]));
+    }
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+class HashJoinNode : public ExecNode {
+ public:
+  HashJoinNode(ExecNode* probe_input, ExecNode* build_input,
+               std::vector<std::string> probe_keys, std::vector<std::string> build_keys,
+               compute::JoinOptions options, std::shared_ptr<Schema> output_schema)
+      : ExecNode(probe_input->plan(), {probe_input, build_input},
+                 std::move(output_schema)),
+        ctx_(probe_input->plan()->context()->pool),
+        probe_keys_(std::move(probe_keys)),
+        build_keys_(std::move(build_keys)),
+        options_(options) {}
+
+  const char* kind_name() const override { return "hash_join"; }
+
+  Status InputReceived(ExecNode* input, std::shared_ptr<RecordBatch> batch) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (input == build_input()) {
+        build_batches_.push_back(std::move(batch));
+        return Status::OK();
+      }
+      if (table_ == nullptr) {
+        pending_probe_batches_.push_back(std::move(batch));
+        return Status::OK();
+      }
+    }
+    // The table is only probed once built, which is thread-safe
+    return Probe(*batch);
+  }
+
+  Status InputFinished(ExecNode* input) override {
+    if (input == build_input()) {
+      return BuildFinished();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      probe_finished_ = true;
+      if (!flushed_) {
+        // Finished once the pending batches are probed
+        return Status::OK();
+      }
+    }
+    return EmitFinished();
+  }
+
+ private:
+  ExecNode* build_input() const { return inputs_[1]; }
+
+  Status Probe(const RecordBatch& batch) {
+    // Probes run concurrently, each with its own context
+    compute::FunctionContext ctx(ctx_.memory_pool());
+    std::shared_ptr<RecordBatch> out;
+    RETURN_NOT_OK(table_->Join(&ctx, batch, probe_keys_, options_, &out));
+    RETURN_NOT_OK(ctx.status());
+    if (out->num_rows() == 0) {
+      return Status::OK();
+    }
+    return EmitBatch(std::move(out));
+  }
+
+  Status BuildFinished() {
+    // No build batch is received anymore, and probe batches are held until
+    // the table is set
+    std::shared_ptr<RecordBatch> build;
+    RETURN_NOT_OK(ConcatenateBatches(build_input()->output_schema(), build_batches_,
+                                     ctx_.memory_pool(), &build));
+    build_batches_.clear();
+    std::unique_ptr<compute::JoinHashTable> table;
+    RETURN_NOT_OK(compute::JoinHashTable::Make(&ctx_, build, build_keys_, &table));
+
+    std::vector<std::shared_ptr<RecordBatch>> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      table_ = std::move(table);
+      pending = std::move(pending_probe_batches_);
+    }
+    for (const auto& batch : pending) {
+      RETURN_NOT_OK(Probe(*batch));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      flushed_ = true;
+      if (!probe_finished_) {
+        return Status::OK();
+      }
+    }
+    return EmitFinished();
+  }
+
+  compute::FunctionContext ctx_;
+  std::vector<std::string> probe_keys_;
+  std::vector<std::string> build_keys_;
+  compute::JoinOptions options_;
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> build_batches_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_probe_batches_;
+  std::unique_ptr<compute::JoinHashTable> table_;
+  bool flushed_ = false;
+  bool probe_finished_ = false;
+};
+
+// ----------------------------------------------------------------------
+// Sink
+
+class CollectSinkNode : public SinkNode {
+ public:
+  explicit CollectSinkNode(ExecNode* input)
+      : SinkNode(input->plan(), {input}, input->output_schema()) {}
+
+  const char* kind_name() const override { return "sink"; }
+
+  Status InputReceived(ExecNode*, std::shared_ptr<RecordBatch> batch) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(std::move(batch));
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode*) override { return Status::OK(); }
+
+  Result<std::shared_ptr<Table>> Finish() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<Table> out;
+    RETURN_NOT_OK(Table::FromRecordBatches(output_schema_, batches_, &out));
+    return out;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+};
+
+}  // namespace
+
+Result<ExecNode*> MakeScanNode(ExecPlan* plan, std::shared_ptr<Scanner> scanner) {
+  return plan->AddNode(
+      std::unique_ptr<ExecNode>(new ScanNode(plan, std::move(scanner))));
+}
+
+Result<ExecNode*> MakeTableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table,
+                                      int64_t morsel_size) {
+  if (morsel_size <= 0) {
+    return Status::Invalid("Morsel size must be greater than 0, got ", morsel_size);
+  }
+  return plan->AddNode(std::unique_ptr<ExecNode>(
+      new TableSourceNode(plan, std::move(table), morsel_size)));
+}
+
+Result<ExecNode*> MakeFilterNode(ExecNode* input, std::shared_ptr<Expression> filter) {
+  const Schema& input_schema = *input->output_schema();
+  RETURN_NOT_OK(input_schema.CanReferenceFieldsByNames(FieldsInExpression(*filter)));
+  ARROW_ASSIGN_OR_RAISE(auto type, filter->Validate(input_schema));
+  if (type->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must be boolean, got ", *type);
+  }
+  return input->plan()->AddNode(
+      std::unique_ptr<ExecNode>(new FilterNode(input, std::move(filter))));
+}
+
+Result<ExecNode*> MakeProjectNode(ExecNode* input,
+                                  std::vector<std::shared_ptr<Expression>> expressions,
+                                  std::vector<std::string> names) {
+  if (!names.empty() && names.size() != expressions.size()) {
+    return Status::Invalid("Expected ", expressions.size(), " column names, got ",
+                           names.size());
+  }
+  const Schema& input_schema = *input->output_schema();
+  std::vector<std::shared_ptr<Field>> fields;
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    const Expression& expression = *expressions[i];
+    RETURN_NOT_OK(input_schema.CanReferenceFieldsByNames(FieldsInExpression(expression)));
+    ARROW_ASSIGN_OR_RAISE(auto type, expression.Validate(input_schema));
+    std::string name;
+    if (!names.empty()) {
+      name = names[i];
+    } else if (expression.type() == ExpressionType::FIELD) {
+      name = checked_cast<const FieldExpression&>(expression).name();
+    } else {
+      name = expression.ToString();
+    }
+    fields.push_back(field(std::move(name), std::move(type)));
+  }
+  return input->plan()->AddNode(std::unique_ptr<ExecNode>(
+      new ProjectNode(input, std::move(expressions), schema(std::move(fields)))));
+}
+
+Result<ExecNode*> MakeAggregateNode(ExecNode* input, std::vector<std::string> keys,
+                                    std::vector<compute::GroupByAggregate> aggregates) {
+  std::unique_ptr<AggregateNode> node(
+      new AggregateNode(input, std::move(keys), std::move(aggregates)));
+  RETURN_NOT_OK(node->Init());
+  return input->plan()->AddNode(std::move(node));
+}
+
+Result<ExecNode*> MakeHashJoinNode(ExecNode* probe_input, ExecNode* build_input,
+                                   std::vector<std::string> probe_keys,
+                                   std::vector<std::string> build_keys,
+                                   compute::JoinOptions options) {
+  if (probe_input == build_input) {
+    return Status::Invalid("A node cannot be both the probe and build input of a join");
+  }
+  if (probe_keys.empty() || probe_keys.size() != build_keys.size()) {
+    return Status::Invalid("Expected as many probe keys as build keys, got ",
+                           probe_keys.size(), " and ", build_keys.size());
+  }
+  const auto& probe_schema = probe_input->output_schema();
+  const auto& build_schema = build_input->output_schema();
+  RETURN_NOT_OK(probe_schema->CanReferenceFieldsByNames(probe_keys));
+  RETURN_NOT_OK(build_schema->CanReferenceFieldsByNames(build_keys));
+  for (size_t i = 0; i < probe_keys.size(); ++i) {
+    const auto& probe_type = probe_schema->GetFieldByName(probe_keys[i])->type();
+    const auto& build_type = build_schema->GetFieldByName(build_keys[i])->type();
+    if (!probe_type->Equals(*build_type)) {
+      return Status::TypeError("Probe key '", probe_keys[i], "' has type ", *probe_type,
+                               ", build key '", build_keys[i], "' has type ",
+                               *build_type);
+    }
+  }
+
+  // Same layout as JoinHashTable::Join
+  std::vector<std::shared_ptr<Field>> fields = probe_schema->fields();
+  if (options.type == compute::JoinOptions::INNER ||
+      options.type == compute::JoinOptions::LEFT_OUTER) {
+    const bool outer = options.type == compute::JoinOptions::LEFT_OUTER;
+    for (const auto& field : build_schema->fields()) {
+      fields.push_back(outer ? field->WithNullable(true) : field);
+    }
+  }
+
+  return probe_input->plan()->AddNode(std::unique_ptr<ExecNode>(
+      new HashJoinNode(probe_input, build_input, std::move(probe_keys),
+                       std::move(build_keys), options, schema(std::move(fields)))));
+}
+
+Result<SinkNode*> MakeSinkNode(ExecNode* input) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto node,
+      input->plan()->AddNode(std::unique_ptr<ExecNode>(new CollectSinkNode(input))));
+  return checked_cast<SinkNode*>(node);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+
+namespace internal {
+class TaskGroup;
+}
+
+namespace dataset {
+
+class ExecPlan;
+
+/// \brief A node of an ExecPlan, processing the batches pushed by its inputs
+/// and pushing its results to its output
+///
+/// Batches are pushed through the nodes of a pipeline on the thread which
+/// produced them, so that a batch is still in cache when the next node
+/// processes it.  Nodes may thus receive batches from several threads at
+/// once.  Pipeline breakers, such as aggregations, push their results once
+/// all of their inputs are finished.
+class ARROW_DS_EXPORT ExecNode {
+ public:
+  virtual ~ExecNode() = default;
+
+  /// \brief The name of the kind of node, e.g. "filter"
+  virtual const char* kind_name() const = 0;
+
+  ExecPlan* plan() const { return plan_; }
+
+  const std::vector<ExecNode*>& inputs() const { return inputs_; }
+
+  /// \brief The node this node pushes to, null for sinks and nodes which were
+  /// not connected yet
+  ExecNode* output() const { return output_; }
+
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  /// \brief Process a batch pushed by one of the inputs
+  ///
+  /// May be called concurrently from several threads.
+  virtual Status InputReceived(ExecNode* input, std::shared_ptr<RecordBatch> batch) = 0;
+
+  /// \brief Called by an input once it pushed all of its batches
+  virtual Status InputFinished(ExecNode* input) = 0;
+
+ protected:
+  ExecNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+           std::shared_ptr<Schema> output_schema);
+
+  /// \brief Start producing batches, for nodes without inputs
+  ///
+  /// Batches must be produced in tasks appended to task_group.
+  virtual Status StartProducing(internal::TaskGroup* task_group);
+
+  /// \brief Push a batch to the output
+  Status EmitBatch(std::shared_ptr<RecordBatch> batch);
+
+  /// \brief Tell the output that all batches were pushed
+  Status EmitFinished();
+
+  ExecPlan* plan_;
+  std::vector<ExecNode*> inputs_;
+  ExecNode* output_ = NULLPTR;
+  std::shared_ptr<Schema> output_schema_;
+
+  friend class ExecPlan;
+};
+
+/// \brief A graph of ExecNodes, from sources producing batches to sinks
+/// collecting them
+///
+/// Every node has at most one output, and every node which is not a sink
+/// must be connected to an output before the plan is run.
+///
+/// \code
+/// ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(context));
+/// ARROW_ASSIGN_OR_RAISE(auto scan, MakeScanNode(plan.get(), scanner));
+/// ARROW_ASSIGN_OR_RAISE(auto filter, MakeFilterNode(scan, ("a"_ > 0).Copy()));
+/// ARROW_ASSIGN_OR_RAISE(auto aggregate, MakeAggregateNode(filter, {"k"}, {...}));
+/// ARROW_ASSIGN_OR_RAISE(auto sink, MakeSinkNode(aggregate));
+/// RETURN_NOT_OK(plan->Run());
+/// ARROW_ASSIGN_OR_RAISE(auto table, sink->Finish());
+/// \endcode
+class ARROW_DS_EXPORT ExecPlan {
+ public:
+  ~ExecPlan();
+
+  /// \brief Make an empty plan
+  ///
+  /// \param[in] context the pool to allocate from, and whether to schedule
+  /// the source tasks on the CPU thread pool
+  static Result<std::shared_ptr<ExecPlan>> Make(std::shared_ptr<ScanContext> context);
+
+  const std::shared_ptr<ScanContext>& context() const { return context_; }
+
+  /// \brief The nodes of the plan, in order of addition
+  const std::vector<std::unique_ptr<ExecNode>>& nodes() const { return nodes_; }
+
+  /// \brief Add a node to the plan, connecting it to the output of its inputs
+  Result<ExecNode*> AddNode(std::unique_ptr<ExecNode> node);
+
+  /// \brief Run the plan until all sources are exhausted, or the first error
+  ///
+  /// A plan can only be run once.
+  Status Run();
+
+ private:
+  explicit ExecPlan(std::shared_ptr<ScanContext> context);
+
+  std::shared_ptr<ScanContext> context_;
+  std::vector<std::unique_ptr<ExecNode>> nodes_;
+  bool started_ = false;
+};
+
+/// \brief A node collecting the batches pushed to it
+class ARROW_DS_EXPORT SinkNode : public ExecNode {
+ public:
+  using ExecNode::ExecNode;
+
+  /// \brief Collect the batches received by the node into a table
+  ///
+  /// When the plan was run on several threads, the order of the batches is
+  /// unspecified.
+  virtual Result<std::shared_ptr<Table>> Finish() = 0;
+};
+
+/// \brief Make a source node producing the batches of the scan tasks of a
+/// scanner, one task per scan task
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeScanNode(ExecPlan* plan, std::shared_ptr<Scanner> scanner);
+
+/// \brief Make a source node producing the rows of a table, one task per
+/// slice of at most morsel_size rows
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeTableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table,
+                                      int64_t morsel_size = 1 << 15);
+
+/// \brief Make a node keeping the rows for which a boolean expression is true
+///
+/// Batches with no row left are dropped.
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeFilterNode(ExecNode* input, std::shared_ptr<Expression> filter);
+
+/// \brief Make a node computing a column from each of a list of expressions
+///
+/// \param[in] input the input node
+/// \param[in] expressions the expressions computing the output columns
+/// \param[in] names the names of the output columns, the names of the
+/// expressions if empty
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeProjectNode(ExecNode* input,
+                                  std::vector<std::shared_ptr<Expression>> expressions,
+                                  std::vector<std::string> names = {});
+
+/// \brief Make a node grouping its input by key columns and aggregating the
+/// other columns, see compute::HashGroupBy
+///
+/// Each thread pushing batches aggregates them into a partial result of its
+/// own; the partial results are merged and pushed once the input is
+/// finished.
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeAggregateNode(ExecNode* input, std::vector<std::string> keys,
+                                    std::vector<compute::GroupByAggregate> aggregates);
+
+/// \brief Make a node joining the batches of a probe input with the rows of
+/// a build input, see compute::JoinHashTable
+///
+/// The hash table is built once the build input is finished.  Probe batches
+/// received before are held until then.
+ARROW_DS_EXPORT
+Result<ExecNode*> MakeHashJoinNode(ExecNode* probe_input, ExecNode* build_input,
+                                   std::vector<std::string> probe_keys,
+                                   std::vector<std::string> build_keys,
+                                   compute::JoinOptions options = compute::JoinOptions());
+
+/// \brief Make a node collecting the batches of its input
+ARROW_DS_EXPORT
+Result<SinkNode*> MakeSinkNode(ExecNode* input);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,273 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_plan.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/builder.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+// clang-format off
+using string_literals::operator"" _;
+// clang-format on
+
+using compute::GroupByAggregate;
+using compute::JoinOptions;
+
+class TestExecPlan : public ::testing::Test {
+ public:
+  void MakePlan(bool use_threads = false) {
+    auto context = std::make_shared<ScanContext>();
+    context->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(plan_, ExecPlan::Make(context));
+  }
+
+  // Run the plan and collect the output of sink
+  std::shared_ptr<Table> Run(SinkNode* sink) {
+    ARROW_EXPECT_OK(plan_->Run());
+    EXPECT_OK_AND_ASSIGN(auto table, sink->Finish());
+    std::shared_ptr<Table> out;
+    ARROW_EXPECT_OK(table->CombineChunks(default_memory_pool(), &out));
+    return out;
+  }
+
+ protected:
+  std::shared_ptr<ExecPlan> plan_;
+};
+
+TEST_F(TestExecPlan, FilterProject) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                             {R"([{"a": 1, "b": "x"}, {"a": 2, "b": "y"},
+                                  {"a": 3, "b": null}, {"a": 0, "b": "z"},
+                                  {"a": 4, "b": "w"}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table, 2));
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, ("a"_ > 1).Copy()));
+  ASSERT_OK_AND_ASSIGN(auto project,
+                       MakeProjectNode(filter,
+                                       {field_ref("b"), ("a"_ < 4).Copy(), scalar(7)},
+                                       {"b", "small", "seven"}));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(project));
+
+  auto expected = TableFromJSON(
+      schema({field("b", utf8()), field("small", boolean()), field("seven", int32())}),
+      {R"([{"b": "y", "small": true, "seven": 7}, {"b": null, "small": true, "seven": 7},
+           {"b": "w", "small": false, "seven": 7}])"});
+  AssertTablesEqual(*expected, *Run(sink));
+}
+
+TEST_F(TestExecPlan, ProjectNames) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("a", int32())}), {R"([{"a": 1}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table));
+  ASSERT_OK_AND_ASSIGN(auto project,
+                       MakeProjectNode(source, {field_ref("a"), ("a"_ == 1).Copy()}));
+  ASSERT_EQ(project->output_schema()->field(0)->name(), "a");
+  ASSERT_EQ(project->output_schema()->field(1)->name(), ("a"_ == 1).ToString());
+}
+
+TEST_F(TestExecPlan, Aggregate) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("k", utf8()), field("v", int64())}),
+                             {R"([{"k": "a", "v": 1}, {"k": "b", "v": 2},
+                                  {"k": "a", "v": 3}, {"k": null, "v": 4},
+                                  {"k": "b", "v": null}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table, 2));
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeAggregateNode(source, {"k"},
+                        {GroupByAggregate(GroupByAggregate::SUM, "v"),
+                         GroupByAggregate(GroupByAggregate::COUNT, "v", "n")}));
+  ASSERT_EQ(aggregate->output_schema()->field(1)->name(), "sum(v)");
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(aggregate));
+
+  auto expected = TableFromJSON(
+      schema({field("k", utf8()), field("sum(v)", int64()), field("n", int64())}),
+      {R"([["a", 4, 2], ["b", 2, 1], [null, 4, 1]])"});
+  AssertTablesEqual(*expected, *Run(sink));
+}
+
+TEST_F(TestExecPlan, AggregateEmptyInput) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("k", utf8()), field("v", int64())}),
+                             {R"([{"k": "a", "v": 1}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table));
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, ("v"_ > 1).Copy()));
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeAggregateNode(filter, {"k"}, {GroupByAggregate(GroupByAggregate::SUM, "v")}));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(aggregate));
+  ASSERT_EQ(Run(sink)->num_rows(), 0);
+}
+
+TEST_F(TestExecPlan, HashJoin) {
+  MakePlan();
+  auto probe = TableFromJSON(schema({field("k", int32()), field("p", utf8())}),
+                             {R"([{"k": 1, "p": "a"}, {"k": 2, "p": "b"},
+                                  {"k": null, "p": "c"}, {"k": 1, "p": "d"}])"});
+  auto build = TableFromJSON(schema({field("bk", int32()), field("v", utf8())}),
+                             {R"([{"bk": 1, "v": "x"}, {"bk": 3, "v": "y"},
+                                  {"bk": 1, "v": "z"}])"});
+  // The probe source runs first, so that its batches are held until the
+  // table is built
+  ASSERT_OK_AND_ASSIGN(auto probe_source, MakeTableSourceNode(plan_.get(), probe, 3));
+  ASSERT_OK_AND_ASSIGN(auto build_source, MakeTableSourceNode(plan_.get(), build, 2));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(probe_source, build_source, {"k"}, {"bk"}));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(join));
+
+  auto expected = TableFromJSON(
+      schema({field("k", int32()), field("p", utf8()), field("bk", int32()),
+              field("v", utf8())}),
+      {R"([[1, "a", 1, "x"], [1, "a", 1, "z"], [1, "d", 1, "x"], [1, "d", 1, "z"]])"});
+  AssertTablesEqual(*expected, *Run(sink));
+}
+
+TEST_F(TestExecPlan, HashJoinLeftAnti) {
+  MakePlan();
+  auto probe = TableFromJSON(schema({field("k", int32())}),
+                             {R"([{"k": 1}, {"k": 2}, {"k": null}])"});
+  auto build = TableFromJSON(schema({field("k", int32())}), {R"([{"k": 1}])"});
+  ASSERT_OK_AND_ASSIGN(auto build_source, MakeTableSourceNode(plan_.get(), build));
+  ASSERT_OK_AND_ASSIGN(auto probe_source, MakeTableSourceNode(plan_.get(), probe));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(probe_source, build_source, {"k"}, {"k"},
+                                        JoinOptions(JoinOptions::LEFT_ANTI)));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(join));
+
+  auto expected =
+      TableFromJSON(schema({field("k", int32())}), {R"([{"k": 2}, {"k": null}])"});
+  AssertTablesEqual(*expected, *Run(sink));
+}
+
+TEST_F(TestExecPlan, Scan) {
+  MakePlan();
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}),
+                                   R"([{"a": 1}, {"a": 2}, {"a": 3}])");
+  auto dataset = std::make_shared<InMemoryDataset>(
+      batch->schema(), RecordBatchVector{batch, batch, batch});
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK(builder->Filter("a"_ != 2));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan_.get(), scanner));
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeAggregateNode(scan, {"a"}, {GroupByAggregate(GroupByAggregate::COUNT, "a")}));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(aggregate));
+
+  auto expected = TableFromJSON(schema({field("a", int32()), field("count(a)", int64())}),
+                                {R"([[1, 3], [3, 3]])"});
+  AssertTablesEqual(*expected, *Run(sink));
+}
+
+TEST_F(TestExecPlan, Threaded) {
+  // Many morsels filtered and aggregated on the thread pool, joined with a
+  // table of key names
+  MakePlan(/*use_threads=*/true);
+  constexpr int64_t kNumRows = 100000;
+  constexpr int64_t kNumKeys = 7;
+  Int64Builder key_builder, value_builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(key_builder.Append(i % kNumKeys));
+    ASSERT_OK(value_builder.Append(i));
+  }
+  std::shared_ptr<Array> keys, values;
+  ASSERT_OK(key_builder.Finish(&keys));
+  ASSERT_OK(value_builder.Finish(&values));
+  auto table = Table::Make(schema({field("k", int64()), field("v", int64())}),
+                           {keys, values});
+  auto names = TableFromJSON(schema({field("id", int64()), field("name", utf8())}),
+                             {R"([{"id": 0, "name": "zero"}, {"id": 3, "name": "three"},
+                                  {"id": 6, "name": "six"}])"});
+
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table, 1000));
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, ("v"_ >= int64_t(10)).Copy()));
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeAggregateNode(filter, {"k"},
+                        {GroupByAggregate(GroupByAggregate::SUM, "v", "sum"),
+                         GroupByAggregate(GroupByAggregate::COUNT, "v", "count")}));
+  ASSERT_OK_AND_ASSIGN(auto names_source, MakeTableSourceNode(plan_.get(), names));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(aggregate, names_source, {"k"}, {"id"}));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(join));
+  auto out = Run(sink);
+  ASSERT_EQ(out->num_rows(), 3);
+
+  const auto& out_keys = static_cast<const Int64Array&>(*out->column(0)->chunk(0));
+  const auto& out_sums = static_cast<const Int64Array&>(*out->column(1)->chunk(0));
+  const auto& out_counts = static_cast<const Int64Array&>(*out->column(2)->chunk(0));
+  for (int64_t row = 0; row < out->num_rows(); ++row) {
+    int64_t sum = 0, count = 0;
+    for (int64_t i = 10; i < kNumRows; ++i) {
+      if (i % kNumKeys == out_keys.Value(row)) {
+        sum += i;
+        ++count;
+      }
+    }
+    ASSERT_EQ(out_keys.Value(row) % 3, 0);
+    ASSERT_EQ(out_sums.Value(row), sum);
+    ASSERT_EQ(out_counts.Value(row), count);
+  }
+}
+
+TEST_F(TestExecPlan, Errors) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("a", int32())}), {R"([{"a": 1}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table));
+
+  ASSERT_RAISES(Invalid, MakeTableSourceNode(plan_.get(), table, 0));
+  ASSERT_RAISES(TypeError, MakeFilterNode(source, field_ref("a")));
+  ASSERT_RAISES(Invalid, MakeFilterNode(source, ("b"_ > 0).Copy()));
+  ASSERT_RAISES(Invalid, MakeProjectNode(source, {field_ref("a")}, {"x", "y"}));
+  ASSERT_RAISES(Invalid, MakeAggregateNode(source, {"b"}, {}));
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(source, source, {"a"}, {"a"}));
+
+  // A node without output
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(source, ("a"_ > 0).Copy()));
+  ASSERT_RAISES(Invalid, MakeSinkNode(source));
+  ASSERT_RAISES(Invalid, plan_->Run());
+  ASSERT_RAISES(Invalid, MakeSinkNode(filter));
+}
+
+TEST_F(TestExecPlan, RunTwice) {
+  MakePlan();
+  auto table = TableFromJSON(schema({field("a", int32())}), {R"([{"a": 1}])"});
+  ASSERT_OK_AND_ASSIGN(auto source, MakeTableSourceNode(plan_.get(), table));
+  ASSERT_OK_AND_ASSIGN(auto sink, MakeSinkNode(source));
+  ASSERT_EQ(Run(sink)->num_rows(), 1);
+  ASSERT_RAISES(Invalid, plan_->Run());
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,20 +17,29 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
+#include "arrow/visitor_inline.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -41,17 +50,127 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using internal::checked_cast;
+
+// The column projection of a scan split for late materialization: the columns
+// of the filter are decoded first, then only the rows which satisfy the filter
+// are decoded in the other columns.
+struct LateMaterializedColumns {
+  std::vector<int> filter_columns;
+  std::vector<int> other_columns;
+};
+
+// Append the runs of rows selected by the boolean result of a filter over the
+// rows [offset, offset + length) read, merging adjacent runs
+static void AppendSelectedRows(const compute::Datum& selection, int64_t offset,
+                               int64_t length, parquet::RowRanges* selected_rows) {
+  auto append = [selected_rows](int64_t start, int64_t end) {
+    if (!selected_rows->empty() && selected_rows->back().end == start) {
+      selected_rows->back().end = end;
+    } else {
+      selected_rows->push_back({start, end});
+    }
+  };
+
+  if (selection.is_scalar()) {
+    const auto& value = checked_cast<const BooleanScalar&>(*selection.scalar());
+    if (value.is_valid && value.value && length > 0) {
+      append(offset, offset + length);
+    }
+    return;
+  }
+
+  BooleanArray mask(selection.array());
+  int64_t run_start = -1;
+  for (int64_t i = 0; i < mask.length(); ++i) {
+    const bool selected = mask.IsValid(i) && mask.Value(i);
+    if (selected && run_start < 0) {
+      run_start = i;
+    } else if (!selected && run_start >= 0) {
+      append(offset + run_start, offset + i);
+      run_start = -1;
+    }
+  }
+  if (run_start >= 0) {
+    append(offset + run_start, offset + mask.length());
+  }
+}
+
+// Map ranges of the rows read out of the row ranges of a RowGroup to ranges of
+// the rows of the RowGroup
+static parquet::RowRanges MapToRowGroup(const parquet::RowRanges& read_rows,
+                                        const parquet::RowRanges& row_ranges) {
+  parquet::RowRanges mapped;
+  size_t range_index = 0;
+  // The index, among the rows read, of the first row of row_ranges[range_index]
+  int64_t range_offset = 0;
+  for (const auto& read_range : read_rows) {
+    int64_t start = read_range.start;
+    while (start < read_range.end) {
+      const parquet::RowRange* range = &row_ranges[range_index];
+      while (range_offset + (range->end - range->start) <= start) {
+        range_offset += range->end - range->start;
+        range = &row_ranges[++range_index];
+      }
+      const int64_t end =
+          std::min(read_range.end, range_offset + (range->end - range->start));
+      mapped.push_back({range->start + start - range_offset,
+                        range->start + end - range_offset});
+      start = end;
+    }
+  }
+  return mapped;
+}
+
+// Yield the batches of the other columns of a late materialized RowGroup,
+// with the matching slices of its filtered filter columns appended
+class LateMaterializedBatchIterator {
+ public:
+  LateMaterializedBatchIterator(std::shared_ptr<Table> filter_columns,
+                                std::unique_ptr<RecordBatchReader> reader)
+      : filter_columns_(std::move(filter_columns)), reader_(std::move(reader)) {}
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadNext(&batch));
+    if (batch == nullptr) {
+      return nullptr;
+    }
+
+    auto fields = batch->schema()->fields();
+    auto columns = batch->columns();
+    for (int i = 0; i < filter_columns_->num_columns(); ++i) {
+      fields.push_back(filter_columns_->field(i));
+      columns.push_back(
+          filter_columns_->column(i)->chunk(0)->Slice(offset_, batch->num_rows()));
+    }
+    offset_ += batch->num_rows();
+    return RecordBatch::Make(schema(std::move(fields)), batch->num_rows(),
+                             std::move(columns));
+  }
+
+ private:
+  // Combined in a single chunk
+  std::shared_ptr<Table> filter_columns_;
+  std::unique_ptr<RecordBatchReader> reader_;
+  int64_t offset_ = 0;
+};
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
-                  std::shared_ptr<ScanContext> context)
+                  std::shared_ptr<ScanContext> context,
+                  std::shared_ptr<parquet::RowRanges> row_ranges = NULLPTR,
+                  std::shared_ptr<const LateMaterializedColumns> late_columns = NULLPTR)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        row_ranges_(std::move(row_ranges)),
+        late_columns_(std::move(late_columns)) {}
 
   Result<RecordBatchIterator> Execute() override {
     // The construction of parquet's RecordBatchReader is deferred here to
@@ -60,19 +179,79 @@ class ParquetScanTask : public ScanTask {
     //
     // Thus the memory incurred by the RecordBatchReader is allocated when
     // Scan is called.
+    if (late_columns_ != nullptr) {
+      return ExecuteLateMaterialized();
+    }
+
     std::unique_ptr<RecordBatchReader> record_batch_reader;
-    RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
-                                                &record_batch_reader));
+    if (row_ranges_ != nullptr) {
+      RETURN_NOT_OK(reader_->GetRecordBatchReader(row_group_, *row_ranges_,
+                                                  column_projection_,
+                                                  &record_batch_reader));
+    } else {
+      RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
+                                                  &record_batch_reader));
+    }
     return IteratorFromReader(std::move(record_batch_reader));
   }
 
  private:
+  Result<RecordBatchIterator> ExecuteLateMaterialized() {
+    const parquet::RowRanges all_rows = {
+        {0, reader_->parquet_reader()->metadata()->RowGroup(row_group_)->num_rows()}};
+    const parquet::RowRanges& row_ranges =
+        row_ranges_ != nullptr ? *row_ranges_ : all_rows;
+
+    // Decode the filter columns, and select the rows which satisfy the filter
+    std::unique_ptr<RecordBatchReader> filter_reader;
+    RETURN_NOT_OK(reader_->GetRecordBatchReader(
+        row_group_, row_ranges, late_columns_->filter_columns, &filter_reader));
+    TreeEvaluator evaluator;
+    RecordBatchVector filtered_batches;
+    parquet::RowRanges selected_rows;
+    int64_t rows_read = 0;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(filter_reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto selection, evaluator.Evaluate(*options_->filter, *batch, context_->pool));
+      ARROW_ASSIGN_OR_RAISE(auto filtered,
+                            evaluator.Filter(selection, batch, context_->pool));
+      filtered_batches.push_back(std::move(filtered));
+      AppendSelectedRows(selection, rows_read, batch->num_rows(), &selected_rows);
+      rows_read += batch->num_rows();
+    }
+    if (selected_rows.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    std::shared_ptr<Table> filter_columns;
+    RETURN_NOT_OK(Table::FromRecordBatches(filter_reader->schema(), filtered_batches,
+                                           &filter_columns));
+    RETURN_NOT_OK(filter_columns->CombineChunks(context_->pool, &filter_columns));
+
+    // Decode only the selected rows of the other columns
+    std::unique_ptr<RecordBatchReader> record_batch_reader;
+    RETURN_NOT_OK(reader_->GetRecordBatchReader(
+        row_group_, MapToRowGroup(selected_rows, row_ranges),
+        late_columns_->other_columns, &record_batch_reader));
+    return RecordBatchIterator(LateMaterializedBatchIterator(
+        std::move(filter_columns), std::move(record_batch_reader)));
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  // The rows of the row group to read, or null to read all of them
+  std::shared_ptr<parquet::RowRanges> row_ranges_;
+  // Null unless the filter columns are decoded ahead of the other columns
+  std::shared_ptr<const LateMaterializedColumns> late_columns_;
 };
 
 static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
@@ -176,19 +355,126 @@ static Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
   return expressions.empty() ? scalar(true) : and_(expressions);
 }
 
-// Skip RowGroups with a filter and metadata
+// Compute the hashes of the non-null values of an array as parquet's column
+// writer inserts them in the bloom filter of a column of a physical type.
+// Types which the writer converts further, e.g. timestamps, aren't supported.
+class BloomFilterHasher {
+ public:
+  BloomFilterHasher(const parquet::BloomFilter& bloom_filter,
+                    parquet::Type::type physical_type)
+      : bloom_filter_(bloom_filter), physical_type_(physical_type) {}
+
+  Result<std::vector<uint64_t>> Hash(const Array& values) {
+    hashes_.clear();
+    values_ = values.data().get();
+    RETURN_NOT_OK(VisitTypeInline(*values.type(), this));
+    return std::move(hashes_);
+  }
+
+  template <typename T>
+  enable_if_t<is_integer_type<T>::value || std::is_same<T, Date32Type>::value, Status>
+  Visit(const T& type) {
+    using c_type = typename T::c_type;
+    switch (physical_type_) {
+      case parquet::Type::INT32:
+        return VisitValues<T>([this](c_type value) {
+          hashes_.push_back(bloom_filter_.Hash(static_cast<int32_t>(value)));
+        });
+      case parquet::Type::INT64:
+        return VisitValues<T>([this](c_type value) {
+          hashes_.push_back(bloom_filter_.Hash(static_cast<int64_t>(value)));
+        });
+      default:
+        return Visit(static_cast<const DataType&>(type));
+    }
+  }
+
+  Status Visit(const FloatType& type) {
+    return VisitFloatingValues(type, parquet::Type::FLOAT);
+  }
+
+  Status Visit(const DoubleType& type) {
+    return VisitFloatingValues(type, parquet::Type::DOUBLE);
+  }
+
+  template <typename T>
+  enable_if_t<std::is_same<T, BinaryType>::value || std::is_same<T, StringType>::value,
+              Status>
+  Visit(const T& type) {
+    if (physical_type_ != parquet::Type::BYTE_ARRAY) {
+      return Visit(static_cast<const DataType&>(type));
+    }
+    return VisitValues<T>([this](util::string_view value) {
+      const parquet::ByteArray byte_array(static_cast<uint32_t>(value.size()),
+                                          reinterpret_cast<const uint8_t*>(value.data()));
+      hashes_.push_back(bloom_filter_.Hash(&byte_array));
+    });
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Bloom filter hashes of ", type, " values");
+  }
+
+ private:
+  template <typename T, typename Func>
+  Status VisitValues(Func&& func) {
+    using ValueType = typename internal::ArrayDataInlineVisitor<T>::c_type;
+    VisitArrayDataInline<T>(*values_, [&](util::optional<ValueType> value) {
+      if (value.has_value()) {
+        func(*value);
+      }
+    });
+    return Status::OK();
+  }
+
+  template <typename T>
+  Status VisitFloatingValues(const T& type, parquet::Type::type physical_type) {
+    if (physical_type_ != physical_type) {
+      return Visit(static_cast<const DataType&>(type));
+    }
+    return VisitValues<T>([this](typename T::c_type value) {
+      hashes_.push_back(bloom_filter_.Hash(value));
+      // Both zeros are equal, but their plain encodings differ
+      if (value == 0) {
+        hashes_.push_back(bloom_filter_.Hash(-value));
+      }
+    });
+  }
+
+  const parquet::BloomFilter& bloom_filter_;
+  parquet::Type::type physical_type_;
+  const ArrayData* values_ = NULLPTR;
+  std::vector<uint64_t> hashes_;
+};
+
+// Skip RowGroups with a filter and metadata, and the bloom filters of their
+// columns for equality and IN predicates which the metadata can't exclude.
+// Within the remaining RowGroups, the page indexes of the columns of the filter
+// select the rows of the pages which their statistics can't exclude.
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
                   parquet::ArrowReaderProperties arrow_properties,
-                  std::shared_ptr<Expression> filter)
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader)
       : metadata_(std::move(metadata)),
         arrow_properties_(std::move(arrow_properties)),
         filter_(std::move(filter)),
+        reader_(reader),
         row_group_idx_(0) {
     num_row_groups_ = metadata_->num_row_groups();
+
+    auto maybe_manifest = GetSchemaManifest(*metadata_, arrow_properties_);
+    if (maybe_manifest.ok()) {
+      for (const auto& schema_field : maybe_manifest.ValueOrDie().schema_fields) {
+        if (schema_field.is_leaf()) {
+          leaf_columns_[schema_field.field->name()] = {schema_field.column_index,
+                                                       schema_field.field->type()};
+        }
+      }
+    }
   }
 
   int Next() {
@@ -196,8 +482,19 @@ class RowGroupSkipper {
       const auto row_group_idx = row_group_idx_++;
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
+      // Bloom filters and page indexes are read lazily, and only for the row
+      // group at hand
+      row_group_reader_.reset();
+      bloom_filters_.clear();
+
       const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
+      if (CanSkip(*row_group, row_group_idx)) {
+        rows_skipped_ += num_rows;
+        continue;
+      }
+
+      row_ranges_ = SelectRows(row_group_idx, num_rows);
+      if (row_ranges_ != nullptr && row_ranges_->empty()) {
         rows_skipped_ += num_rows;
         continue;
       }
@@ -208,8 +505,17 @@ class RowGroupSkipper {
     return kIterationDone;
   }
 
+  // The rows of the RowGroup last returned by Next() to read, or null to read
+  // all of them
+  const std::shared_ptr<parquet::RowRanges>& row_ranges() const { return row_ranges_; }
+
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
+  struct LeafColumn {
+    int index;
+    std::shared_ptr<DataType> type;
+  };
+
+  bool CanSkip(const parquet::RowGroupMetaData& metadata, int row_group_idx) {
     auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata, arrow_properties_);
     // Errors with statistics are ignored and post-filtering will apply.
     if (!maybe_stats_expr.ok()) {
@@ -218,12 +524,197 @@ class RowGroupSkipper {
 
     auto stats_expr = maybe_stats_expr.ValueOrDie();
     auto expr = filter_->Assume(stats_expr);
-    return (expr->IsNull() || expr->Equals(false));
+    if (expr->IsNull() || expr->Equals(false)) {
+      return true;
+    }
+
+    return BloomFiltersExclude(*expr, row_group_idx);
+  }
+
+  // The rows of a RowGroup which the page indexes of the columns of the filter
+  // can't exclude, or null if none of these columns has a page index
+  std::shared_ptr<parquet::RowRanges> SelectRows(int row_group_idx, int64_t num_rows) {
+    std::shared_ptr<parquet::RowRanges> row_ranges;
+    auto field_names = FieldsInExpression(*filter_);
+    for (const auto& field_name : std::unordered_set<std::string>(field_names.begin(),
+                                                                   field_names.end())) {
+      auto it = leaf_columns_.find(field_name);
+      if (it == leaf_columns_.end()) {
+        continue;
+      }
+      auto column_row_ranges =
+          PageIndexRowRanges(field_name, it->second, row_group_idx, num_rows);
+      if (column_row_ranges == nullptr) {
+        continue;
+      }
+      if (row_ranges == nullptr) {
+        row_ranges = std::move(column_row_ranges);
+      } else {
+        *row_ranges = parquet::IntersectRowRanges(*row_ranges, *column_row_ranges);
+      }
+    }
+    return row_ranges;
+  }
+
+  // The rows of the pages of a column chunk whose statistics in its page index
+  // can't exclude the filter, or null if it has no page index
+  std::shared_ptr<parquet::RowRanges> PageIndexRowRanges(const std::string& field_name,
+                                                         const LeafColumn& column,
+                                                         int row_group_idx,
+                                                         int64_t num_rows) {
+    // As with statistics, errors reading page indexes are ignored
+    try {
+      if (row_group_reader_ == nullptr) {
+        row_group_reader_ = reader_->RowGroup(row_group_idx);
+      }
+      auto column_index = row_group_reader_->GetColumnIndex(column.index);
+      auto offset_index = row_group_reader_->GetOffsetIndex(column.index);
+      if (column_index == nullptr || offset_index == nullptr) {
+        return nullptr;
+      }
+      const size_t num_pages = offset_index->page_locations.size();
+      if (column_index->null_pages.size() != num_pages) {
+        return nullptr;
+      }
+
+      const parquet::ColumnDescriptor* descr = metadata_->schema()->Column(column.index);
+      auto field_expr = field_ref(field_name);
+      std::vector<bool> selected_pages(num_pages, true);
+      for (size_t i = 0; i < num_pages; ++i) {
+        std::shared_ptr<Expression> page_expr;
+        if (column_index->null_pages[i]) {
+          page_expr = equal(field_expr, scalar(MakeNullScalar(column.type)));
+        } else {
+          const int64_t null_count =
+              column_index->null_counts.empty() ? 0 : column_index->null_counts[i];
+          auto statistics = parquet::Statistics::Make(
+              descr, column_index->min_values[i], column_index->max_values[i],
+              /*num_values=*/0, null_count, /*distinct_count=*/0, /*has_min_max=*/true);
+          std::shared_ptr<Scalar> min, max;
+          if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
+            continue;
+          }
+          page_expr = and_(greater_equal(field_expr, scalar(min)),
+                           less_equal(field_expr, scalar(max)));
+        }
+        auto expr = filter_->Assume(page_expr);
+        selected_pages[i] = !(expr->IsNull() || expr->Equals(false));
+      }
+      return std::make_shared<parquet::RowRanges>(
+          parquet::PageRowRanges(*offset_index, selected_pages, num_rows));
+    } catch (const ::parquet::ParquetException&) {
+      return nullptr;
+    }
+  }
+
+  // Whether the bloom filters of a row group show that none of its rows
+  // satisfies the expression
+  bool BloomFiltersExclude(const Expression& expr, int row_group_idx) {
+    switch (expr.type()) {
+      case ExpressionType::AND: {
+        const auto& and_expr = checked_cast<const AndExpression&>(expr);
+        return BloomFiltersExclude(*and_expr.left_operand(), row_group_idx) ||
+               BloomFiltersExclude(*and_expr.right_operand(), row_group_idx);
+      }
+      case ExpressionType::OR: {
+        const auto& or_expr = checked_cast<const OrExpression&>(expr);
+        return BloomFiltersExclude(*or_expr.left_operand(), row_group_idx) &&
+               BloomFiltersExclude(*or_expr.right_operand(), row_group_idx);
+      }
+      case ExpressionType::COMPARISON: {
+        const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+        if (comparison.op() != compute::CompareOperator::EQUAL) {
+          return false;
+        }
+        const Expression* field = comparison.left_operand().get();
+        const Expression* value = comparison.right_operand().get();
+        if (field->type() == ExpressionType::SCALAR) {
+          std::swap(field, value);
+        }
+        if (field->type() != ExpressionType::FIELD ||
+            value->type() != ExpressionType::SCALAR) {
+          return false;
+        }
+        const auto& scalar = checked_cast<const ScalarExpression&>(*value).value();
+        std::shared_ptr<Array> values;
+        if (!scalar->is_valid || !MakeArrayFromScalar(*scalar, 1, &values).ok()) {
+          return false;
+        }
+        return BloomFilterExcludes(checked_cast<const FieldExpression&>(*field).name(),
+                                   *values, row_group_idx);
+      }
+      case ExpressionType::IN: {
+        // Null values are in sets with nulls, but aren't in bloom filters
+        const auto& in_expr = checked_cast<const InExpression&>(expr);
+        if (in_expr.operand()->type() != ExpressionType::FIELD ||
+            in_expr.set()->null_count() != 0) {
+          return false;
+        }
+        return BloomFilterExcludes(
+            checked_cast<const FieldExpression&>(*in_expr.operand()).name(),
+            *in_expr.set(), row_group_idx);
+      }
+      default:
+        return false;
+    }
+  }
+
+  // Whether none of the values is in the bloom filter of a column chunk
+  bool BloomFilterExcludes(const std::string& field_name, const Array& values,
+                           int row_group_idx) {
+    auto it = leaf_columns_.find(field_name);
+    if (it == leaf_columns_.end() || !values.type()->Equals(*it->second.type)) {
+      return false;
+    }
+    const int column_index = it->second.index;
+
+    const parquet::BloomFilter* bloom_filter =
+        GetBloomFilter(row_group_idx, column_index);
+    if (bloom_filter == nullptr) {
+      return false;
+    }
+
+    BloomFilterHasher hasher(*bloom_filter,
+                             metadata_->schema()->Column(column_index)->physical_type());
+    auto maybe_hashes = hasher.Hash(values);
+    if (!maybe_hashes.ok()) {
+      return false;
+    }
+    for (uint64_t hash : maybe_hashes.ValueOrDie()) {
+      if (bloom_filter->FindHash(hash)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const parquet::BloomFilter* GetBloomFilter(int row_group_idx, int column_index) {
+    auto it = bloom_filters_.find(column_index);
+    if (it != bloom_filters_.end()) {
+      return it->second.get();
+    }
+
+    std::unique_ptr<parquet::BloomFilter> bloom_filter;
+    // As with statistics, errors reading bloom filters are ignored
+    try {
+      if (row_group_reader_ == nullptr) {
+        row_group_reader_ = reader_->RowGroup(row_group_idx);
+      }
+      bloom_filter = row_group_reader_->GetColumnBloomFilter(column_index);
+    } catch (const ::parquet::ParquetException&) {
+    }
+    return (bloom_filters_[column_index] = std::move(bloom_filter)).get();
   }
 
   std::shared_ptr<parquet::FileMetaData> metadata_;
   parquet::ArrowReaderProperties arrow_properties_;
   std::shared_ptr<Expression> filter_;
+  // Owned by the parquet::arrow::FileReader of the scan
+  parquet::ParquetFileReader* reader_;
+  std::unordered_map<std::string, LeafColumn> leaf_columns_;
+  std::shared_ptr<parquet::RowGroupReader> row_group_reader_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+  std::shared_ptr<parquet::RowRanges> row_ranges_;
   int row_group_idx_;
   int num_row_groups_;
   int64_t rows_skipped_;
@@ -234,21 +725,27 @@ class ParquetScanTaskIterator {
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
                                        std::unique_ptr<parquet::ParquetFileReader> reader,
-                                       parquet::ArrowReaderProperties arrow_properties) {
+                                       parquet::ArrowReaderProperties arrow_properties,
+                                       bool late_materialization) {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, arrow_properties, options);
+    std::shared_ptr<const LateMaterializedColumns> late_columns;
+    if (late_materialization) {
+      late_columns =
+          SplitColumnProjection(*metadata, arrow_properties, *options, column_projection);
+    }
 
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
                                                    arrow_properties, &arrow_reader));
 
     RowGroupSkipper skipper(std::move(metadata), std::move(arrow_properties),
-                            options->filter);
+                            options->filter, arrow_reader->parquet_reader());
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(skipper), std::move(arrow_reader)));
+        std::move(late_columns), std::move(skipper), std::move(arrow_reader)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -260,7 +757,8 @@ class ParquetScanTaskIterator {
     }
 
     return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_,
+                            skipper_.row_ranges(), late_columns_));
   }
 
  private:
@@ -298,6 +796,53 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // Split the column projection for late materialization, or return null if
+  // the filter can't be evaluated against the leaf columns of the file alone,
+  // or all the projected columns are filter columns
+  static std::shared_ptr<const LateMaterializedColumns> SplitColumnProjection(
+      const parquet::FileMetaData& metadata,
+      const parquet::ArrowReaderProperties& arrow_properties, const ScanOptions& options,
+      const std::vector<int>& column_projection) {
+    auto maybe_manifest = GetSchemaManifest(metadata, arrow_properties);
+    if (!maybe_manifest.ok()) {
+      return nullptr;
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+    std::unordered_map<std::string, const SchemaField*> leaf_fields;
+    for (const auto& schema_field : manifest.schema_fields) {
+      if (schema_field.is_leaf()) {
+        leaf_fields[schema_field.field->name()] = &schema_field;
+      }
+    }
+
+    auto late_columns = std::make_shared<LateMaterializedColumns>();
+    std::unordered_set<int> filter_columns;
+    FieldVector filter_fields;
+    for (const auto& name : FieldsInExpression(*options.filter)) {
+      auto it = leaf_fields.find(name);
+      if (it == leaf_fields.end()) {
+        return nullptr;
+      }
+      if (filter_columns.insert(it->second->column_index).second) {
+        late_columns->filter_columns.push_back(it->second->column_index);
+        filter_fields.push_back(it->second->field);
+      }
+    }
+    if (filter_columns.empty() || !options.filter->Validate(Schema(filter_fields)).ok()) {
+      return nullptr;
+    }
+
+    for (int column : column_projection) {
+      if (filter_columns.find(column) == filter_columns.end()) {
+        late_columns->other_columns.push_back(column);
+      }
+    }
+    if (late_columns->other_columns.empty()) {
+      return nullptr;
+    }
+    return late_columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -312,17 +857,21 @@ class ParquetScanTaskIterator {
 
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
-                          std::vector<int> column_projection, RowGroupSkipper skipper,
+                          std::vector<int> column_projection,
+                          std::shared_ptr<const LateMaterializedColumns> late_columns,
+                          RowGroupSkipper skipper,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
+        late_columns_(std::move(late_columns)),
         skipper_(std::move(skipper)),
         reader_(std::move(reader)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
+  std::shared_ptr<const LateMaterializedColumns> late_columns_;
   RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
@@ -378,7 +927,8 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
 
   auto arrow_properties = MakeArrowReaderProperties(*this, options->batch_size, *reader);
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
-                                       std::move(reader), std::move(arrow_properties));
+                                       std::move(reader), std::move(arrow_properties),
+                                       reader_options.late_materialization);
 }
 
 }  // namespace dataset
@@ -75,6 +75,12 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// Decode the columns of the filter of a scan first, then only the rows which
+    /// satisfy it in the other columns, skipping the data pages without any. This
+    /// pays off for selective filters on wide tables. The batches scanned hold
+    /// only the rows which satisfy the filter, and the filter columns last.
+    bool late_materialization = false;
   } reader_options;
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -18,6 +18,8 @@
 #include "arrow/dataset/file_parquet.h"
 
 #include <memory>
+#include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -132,6 +134,37 @@ class TestParquetFileFormat : public ArrowParquetWriterMixin {
     return internal::make_unique<FileSource>(std::move(buffer));
   }
 
+  // Write one row group per batch
+  std::unique_ptr<FileSource> GetFileSource(
+      const RecordBatchVector& row_groups,
+      const std::shared_ptr<WriterProperties>& properties) {
+    auto pool = ::arrow::default_memory_pool();
+    auto sink = CreateOutputStream(pool);
+    std::unique_ptr<FileWriter> writer;
+    ARROW_EXPECT_OK(FileWriter::Open(*row_groups[0]->schema(), pool, sink, properties,
+                                     default_arrow_writer_properties(), &writer));
+    for (const auto& batch : row_groups) {
+      ARROW_EXPECT_OK(WriteRecordBatch(*batch, writer.get()));
+    }
+    ARROW_EXPECT_OK(writer->Close());
+    std::shared_ptr<Buffer> buffer;
+    EXPECT_OK_AND_ASSIGN(buffer, sink->Finish());
+    return internal::make_unique<FileSource>(std::move(buffer));
+  }
+
+  // A batch of the given ids, named after their decimal representation
+  std::shared_ptr<RecordBatch> IdNameBatch(const std::vector<int64_t>& ids) {
+    std::vector<std::string> names;
+    for (int64_t id : ids) {
+      names.push_back(std::to_string(id));
+    }
+    std::shared_ptr<Array> id_array, name_array;
+    ArrayFromVector<Int64Type>(ids, &id_array);
+    ArrayFromVector<StringType, std::string>(names, &name_array);
+    return RecordBatch::Make(id_name_schema_, static_cast<int64_t>(ids.size()),
+                             {id_array, name_array});
+  }
+
   std::unique_ptr<RecordBatchReader> GetRecordBatchReader(
       std::shared_ptr<Schema> schema = nullptr) {
     return MakeGeneratedRecordBatch(schema ? schema : schema_, kBatchSize,
@@ -166,6 +199,8 @@ class TestParquetFileFormat : public ArrowParquetWriterMixin {
 
  protected:
   std::shared_ptr<Schema> schema_ = schema({field("f64", float64())});
+  std::shared_ptr<Schema> id_name_schema_ =
+      schema({field("id", int64()), field("name", utf8())});
   std::shared_ptr<ParquetFileFormat> format_ = std::make_shared<ParquetFileFormat>();
   std::shared_ptr<ScanOptions> opts_;
   std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
@@ -398,5 +433,119 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Row group `r` holds the ids equal to `r` modulo 8, so that the statistics
+  // of the row groups overlap and only their bloom filters can skip them.
+  constexpr int kNumRowGroups = 4;
+  constexpr int kRowsPerRowGroup = 100;
+  RecordBatchVector row_groups;
+  for (int r = 0; r < kNumRowGroups; r++) {
+    std::vector<int64_t> ids;
+    for (int i = 0; i < kRowsPerRowGroup; i++) {
+      ids.push_back(8 * i + r);
+    }
+    row_groups.push_back(IdNameBatch(ids));
+  }
+  auto source = GetFileSource(
+      row_groups, WriterProperties::Builder().enable_bloom_filter()->build());
+
+  opts_ = ScanOptions::Make(id_name_schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  opts_->filter = ("id"_ == int64_t(8 * 10 + 2)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kRowsPerRowGroup, 1);
+  opts_->filter = ("name"_ == std::string("83")).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kRowsPerRowGroup, 1);
+
+  // Between the minimum and the maximum of every row group, but in none
+  opts_->filter = ("id"_ == int64_t(8 * 10 + 5)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+  opts_->filter = ("name"_ == std::string("85")).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+
+  opts_->filter = ("id"_ == int64_t(8 * 10 + 1) or "id"_ == int64_t(8 * 20 + 3)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 2 * kRowsPerRowGroup, 2);
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[0, 81, 85]"))).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 2 * kRowsPerRowGroup, 2);
+  opts_->filter = ("id"_.In(ArrayFromJSON(int64(), "[5, 85, 165]"))).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+
+  // Bloom filters only exclude values
+  opts_->filter = ("id"_ != int64_t(8 * 10 + 5)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kNumRowGroups * kRowsPerRowGroup,
+                            kNumRowGroups);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group of sorted ids, written in pages of kRowsPerPage rows so
+  // that only the page index can skip rows.
+  constexpr int kNumPages = 10;
+  constexpr int kRowsPerPage = 100;
+  std::vector<int64_t> ids(kNumPages * kRowsPerPage);
+  std::iota(ids.begin(), ids.end(), 0);
+  auto properties = WriterProperties::Builder()
+                        .enable_page_index()
+                        ->disable_dictionary()
+                        ->write_batch_size(kRowsPerPage)
+                        ->data_pagesize(1)
+                        ->build();
+  auto source = GetFileSource({IdNameBatch(ids)}, properties);
+
+  opts_ = ScanOptions::Make(id_name_schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(fragment.get(), kNumPages * kRowsPerPage, 1);
+
+  opts_->filter = ("id"_ == int64_t(425)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kRowsPerPage, 1);
+  opts_->filter = ("id"_ < int64_t(250)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 3 * kRowsPerPage, 1);
+  opts_->filter = ("id"_ < int64_t(150) or "id"_ >= int64_t(950)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 3 * kRowsPerPage, 1);
+  opts_->filter = ("id"_ >= int64_t(250) and "id"_ < int64_t(350)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 2 * kRowsPerPage, 1);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  constexpr int kNumRows = 1000;
+  std::vector<int64_t> ids(kNumRows);
+  std::iota(ids.begin(), ids.end(), 0);
+  auto source = GetFileSource({IdNameBatch(ids)},
+                              WriterProperties::Builder().write_batch_size(100)->build());
+
+  format_->reader_options.late_materialization = true;
+  opts_ = ScanOptions::Make(id_name_schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  // Only the rows which satisfy the filter are scanned
+  opts_->filter = ("id"_ < int64_t(5) or "id"_ >= int64_t(995)).Copy();
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    auto batch_ids = std::static_pointer_cast<Int64Array>(batch->GetColumnByName("id"));
+    auto batch_names =
+        std::static_pointer_cast<StringArray>(batch->GetColumnByName("name"));
+    ASSERT_NE(batch_ids, nullptr);
+    ASSERT_NE(batch_names, nullptr);
+    for (int64_t i = 0; i < batch->num_rows(); i++) {
+      const int64_t id = batch_ids->Value(i);
+      EXPECT_TRUE(id < 5 || id >= 995) << id;
+      EXPECT_EQ(std::to_string(id), batch_names->GetString(i));
+    }
+    row_count += batch->num_rows();
+  }
+  EXPECT_EQ(row_count, 10);
+
+  opts_->filter = ("name"_ == std::string("425")).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 1, 1);
+  opts_->filter = ("name"_ == std::string("4250")).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+
+  // Filters on fields missing from the file are left to the scanner
+  opts_->filter = ("id"_ == int64_t(425) and "missing"_ == int64_t(1)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kNumRows, 1);
+}
+
 }  // namespace dataset
 }  // namespace arrow
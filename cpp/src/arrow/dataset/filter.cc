@@ -1090,21 +1090,97 @@ struct TreeEvaluator::Impl {
   }
 
   Result<Datum> operator()(const AndExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneAnd);
+    return EvaluateBoolean(expr, compute::CompareAnd, compute::KleeneAnd);
   }
 
   Result<Datum> operator()(const OrExpression& expr) const {
-    return EvaluateBoolean(expr, compute::KleeneOr);
+    return EvaluateBoolean(expr, compute::CompareOr, compute::KleeneOr);
+  }
+
+  // A chain of conjunctions (or disjunctions) is evaluated as a whole: its
+  // comparisons of columns with scalars are evaluated by a single fused kernel,
+  // avoiding a boolean array per comparison, and the result is combined with
+  // those of the other operands.
+  Result<Datum> EvaluateBoolean(
+      const BinaryExpression& expr,
+      Status fused_kernel(compute::FunctionContext* context,
+                          const std::vector<compute::ScalarComparison>& comparisons,
+                          compute::Datum* out),
+      Status kernel(compute::FunctionContext* context, const compute::Datum& left,
+                    const compute::Datum& right, compute::Datum* out)) const {
+    std::vector<const Expression*> operands;
+    FlattenOperands(expr, expr.type(), &operands);
+
+    std::vector<compute::ScalarComparison> comparisons;
+    std::vector<const Expression*> others;
+    for (const Expression* operand : operands) {
+      if (!GetScalarComparison(*operand, &comparisons)) {
+        others.push_back(operand);
+      }
+    }
+    if (comparisons.size() == 1) {
+      // nothing to fuse
+      comparisons.clear();
+      others = std::move(operands);
+    }
+
+    Datum out;
+    if (!comparisons.empty()) {
+      RETURN_NOT_OK(fused_kernel(&ctx_, comparisons, &out));
+    }
+    for (const Expression* other : others) {
+      ARROW_ASSIGN_OR_RAISE(auto operand, Evaluate(*other));
+      if (out.kind() == Datum::NONE) {
+        out = std::move(operand);
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(out, CombineBoolean(std::move(out), std::move(operand),
+                                                kernel));
+    }
+    return std::move(out);
   }
 
-  Result<Datum> EvaluateBoolean(const BinaryExpression& expr,
-                                Status kernel(compute::FunctionContext* context,
-                                              const compute::Datum& left,
-                                              const compute::Datum& right,
-                                              compute::Datum* out)) const {
-    ARROW_ASSIGN_OR_RAISE(auto lhs, Evaluate(*expr.left_operand()));
-    ARROW_ASSIGN_OR_RAISE(auto rhs, Evaluate(*expr.right_operand()));
+  static void FlattenOperands(const Expression& expr, ExpressionType::type type,
+                              std::vector<const Expression*>* out) {
+    if (expr.type() != type) {
+      out->push_back(&expr);
+      return;
+    }
+    const auto& binary = checked_cast<const BinaryExpression&>(expr);
+    FlattenOperands(*binary.left_operand(), type, out);
+    FlattenOperands(*binary.right_operand(), type, out);
+  }
+
+  // Append the comparison of a column of the batch with a valid scalar of the
+  // same type, if expr is one
+  bool GetScalarComparison(const Expression& expr,
+                           std::vector<compute::ScalarComparison>* out) const {
+    if (expr.type() != ExpressionType::COMPARISON) {
+      return false;
+    }
+    const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+    const auto& lhs = *comparison.left_operand();
+    const auto& rhs = *comparison.right_operand();
+    if (lhs.type() != ExpressionType::FIELD || rhs.type() != ExpressionType::SCALAR) {
+      return false;
+    }
+
+    auto column =
+        batch_.GetColumnByName(checked_cast<const FieldExpression&>(lhs).name());
+    const auto& scalar = checked_cast<const ScalarExpression&>(rhs).value();
+    if (column == nullptr || !scalar->is_valid ||
+        !column->type()->Equals(*scalar->type)) {
+      return false;
+    }
+    out->emplace_back(std::move(column), comparison.op(), scalar);
+    return true;
+  }
 
+  Result<Datum> CombineBoolean(Datum lhs, Datum rhs,
+                               Status kernel(compute::FunctionContext* context,
+                                             const compute::Datum& left,
+                                             const compute::Datum& right,
+                                             compute::Datum* out)) const {
     if (lhs.is_scalar()) {
       std::shared_ptr<Array> lhs_array;
       RETURN_NOT_OK(MakeArrayFromScalar(ctx_.memory_pool(), *lhs.scalar(),
@@ -269,6 +269,34 @@ TEST_F(FilterTest, Basics) {
   ])");
 }
 
+TEST_F(FilterTest, FusedComparisons) {
+  // the comparisons with scalars of a chain are evaluated by a single kernel,
+  // combined with the results of the other operands
+  AssertFilter("a"_ > 0 or "b"_ == "x" or "c"_.IsValid(),
+               {field("a", int32()), field("b", utf8()), field("c", boolean())},
+               R"([
+      {"a": 1,    "b": "y",  "c": null,  "in": 1},
+      {"a": 0,    "b": "x",  "c": null,  "in": 1},
+      {"a": 0,    "b": "y",  "c": false, "in": 1},
+      {"a": 0,    "b": "y",  "c": null,  "in": 0},
+      {"a": null, "b": "y",  "c": null,  "in": null},
+      {"a": null, "b": null, "c": true,  "in": 1},
+      {"a": 0,    "b": null, "c": null,  "in": null}
+  ])");
+
+  AssertFilter("a"_ >= 0 and "a"_ < 2 and "c"_ == true and not("b"_ == "y"),
+               {field("a", int32()), field("b", utf8()), field("c", boolean())},
+               R"([
+      {"a": 1,    "b": "x",  "c": true,  "in": 1},
+      {"a": 2,    "b": "x",  "c": true,  "in": 0},
+      {"a": 0,    "b": "y",  "c": true,  "in": 0},
+      {"a": 0,    "b": "x",  "c": false, "in": 0},
+      {"a": null, "b": "x",  "c": true,  "in": null},
+      {"a": null, "b": "x",  "c": false, "in": 0},
+      {"a": 0,    "b": null, "c": true,  "in": null}
+  ])");
+}
+
 TEST_F(FilterTest, InExpression) {
   auto hello_world = ArrayFromJSON(utf8(), R"(["hello", "world"])");
 
@@ -31,6 +31,7 @@
 #endif
 
 #ifdef _WIN32
+#include <immintrin.h>
 #include <intrin.h>
 #include <array>
 #include <bitset>
@@ -38,6 +39,10 @@
 
 #endif
 
+#if (defined(__i386) || defined(__x86_64__)) && defined(__GNUC__)
+#include <cpuid.h>
+#endif
+
 #include <algorithm>
 #include <cerrno>
 #include <cstdint>
@@ -125,6 +130,7 @@ static struct {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
     {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -146,6 +152,16 @@ int64_t ParseCPUFlags(const std::string& values) {
       flags |= flag_mappings[i].flag;
     }
   }
+#if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
+  // AVX512 stands for all the AVX-512 subsets of Skylake-SP
+  bool has_avx512 = true;
+  for (const char* name : {"avx512f", "avx512cd", "avx512dq", "avx512bw", "avx512vl"}) {
+    has_avx512 = has_avx512 && values.find(name) != std::string::npos;
+  }
+  if (has_avx512) {
+    flags |= CpuInfo::AVX512;
+  }
+#endif
   return flags;
 }
 
@@ -235,10 +251,58 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  if (highest_valid_id >= 7) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+    // AVX-512 F, DQ, CD, BW and VL
+    if (features_EBX[16] && features_EBX[17] && features_EBX[28] && features_EBX[30] &&
+        features_EBX[31]) {
+      *hardware_flags |= CpuInfo::AVX512;
+    }
+  }
   return true;
 }
 #endif
 
+#if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
+// The vector flags whose registers the OS saves on context switches, as
+// reported by XCR0: AVX and AVX-512 instructions fault without it, even when
+// the CPU supports them
+static int64_t OsSavedVectorFlags() {
+  uint64_t xcr0 = 0;
+#ifdef _MSC_VER
+  int cpu_info[4];
+  __cpuid(cpu_info, 1);
+  // OSXSAVE: XGETBV is enabled
+  if ((cpu_info[2] & (1 << 27)) == 0) {
+    return 0;
+  }
+  xcr0 = _xgetbv(0);
+#elif defined(__GNUC__)
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & (1 << 27)) == 0) {
+    return 0;
+  }
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  xcr0 = (static_cast<uint64_t>(edx) << 32) | eax;
+#else
+  return 0;
+#endif
+  int64_t flags = 0;
+  // XMM and YMM state
+  if ((xcr0 & 0x6) == 0x6) {
+    flags |= CpuInfo::AVX2;
+    // Opmask, upper ZMM0-15 and ZMM16-31 state
+    if ((xcr0 & 0xe0) == 0xe0) {
+      flags |= CpuInfo::AVX512;
+    }
+  }
+  return flags;
+}
+#endif
+
 CpuInfo::CpuInfo() : hardware_flags_(0), num_cores_(1), model_name_("unknown") {}
 
 std::unique_ptr<CpuInfo> g_cpu_info;
@@ -326,6 +390,10 @@ void CpuInfo::Init() {
   } else {
     cycles_per_ms_ = 1000000;
   }
+#if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
+  const int64_t vector_flags = CpuInfo::AVX2 | CpuInfo::AVX512;
+  hardware_flags_ &= ~vector_flags | OsSavedVectorFlags();
+#endif
   original_hardware_flags_ = hardware_flags_;
 
   if (num_cores > 0) {
@@ -138,6 +138,19 @@
 #define ARROW_DISABLE_UBSAN(feature)
 #endif
 
+// ----------------------------------------------------------------------
+// Macros compiling a function for an instruction set extension, whatever the
+// build flags.  Callers must check at runtime that the CPU supports it.
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#define ARROW_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#define ARROW_TARGET_AVX512 \
+  __attribute__((target("avx512f,avx512cd,avx512dq,avx512bw,avx512vl")))
+#endif
+
 // ----------------------------------------------------------------------
 // Machine information
 
@@ -172,6 +172,45 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Decode the code point starting at *data, and advance *data past it.
+// Returns false on an invalid or truncated sequence.
+inline bool UTF8Decode(const uint8_t** data, const uint8_t* end, uint32_t* codepoint) {
+  const uint8_t* pos = *data;
+  uint8_t state = internal::kUTF8DecodeAccept;
+  do {
+    if (pos == end) {
+      return false;
+    }
+    state = internal::DecodeOneUTF8Byte(*pos++, state, codepoint);
+    if (state == internal::kUTF8DecodeReject) {
+      return false;
+    }
+  } while (state != internal::kUTF8DecodeAccept);
+  *data = pos;
+  return true;
+}
+
+// Encode a code point as 1 to 4 bytes starting at out, and return the end of
+// the encoded sequence.
+inline uint8_t* UTF8Encode(uint8_t* out, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    *out++ = static_cast<uint8_t>(codepoint);
+  } else if (codepoint < 0x800) {
+    *out++ = static_cast<uint8_t>(0xC0 | (codepoint >> 6));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    *out++ = static_cast<uint8_t>(0xE0 | (codepoint >> 12));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+  } else {
+    *out++ = static_cast<uint8_t>(0xF0 | (codepoint >> 18));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 12) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+  }
+  return out;
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
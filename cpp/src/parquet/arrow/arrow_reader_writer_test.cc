@@ -2031,6 +2031,145 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderThreaded) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (int32_t batch_readahead : {0, 1, 3, 20}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(batch_size);
+    properties.set_use_threads(true);
+    properties.set_batch_readahead(batch_readahead);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+    ::arrow::TableBatchReader table_reader(*table);
+    table_reader.set_chunksize(batch_size);
+
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+      ASSERT_OK(table_reader.ReadNext(&expected_batch));
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+    }
+
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+
+    // Destroy a reader while it decodes ahead
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    rb_reader.reset();
+  }
+}
+
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  const std::vector<int> row_groups = {1, 3};
+  const std::vector<int> column_indices = {0, 4, 5, 19};
+  std::shared_ptr<Table> expected;
+  {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups(row_groups, column_indices, &expected));
+  }
+
+  // Coalesce all the column chunks, and none of them
+  for (int64_t hole_size_limit : {int64_t(1) << 20, int64_t(0)}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_pre_buffer(true);
+    properties.set_pre_buffer_limits(hole_size_limit,
+                                     kArrowDefaultPreBufferRangeSizeLimit);
+    properties.set_batch_size(num_rows / 4);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups(row_groups, column_indices, &actual));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *actual));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(
+        reader->GetRecordBatchReader(row_groups, column_indices, &rb_reader));
+    ASSERT_OK(rb_reader->ReadAll(&actual));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false));
+
+    ASSERT_RAISES(IOError, reader->ReadRowGroups({4}, column_indices, &actual));
+  }
+}
+
+TEST(TestArrowReadWrite, PreBufferPaddedColumnChunks) {
+  // Files of writers older than the PARQUET-816 fix have their column chunk
+  // ranges padded, which makes the ranges of adjacent column chunks overlap
+  const int num_columns = 5;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .created_by("parquet-mr version 1.2.8 (build 0)")
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  const std::vector<int> row_groups = {0, 1};
+  const std::vector<int> column_indices = {1, 2, 3};
+  std::shared_ptr<Table> expected;
+  {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    ASSERT_TRUE(reader->parquet_reader()->metadata()->writer_version().VersionLt(
+        ApplicationVersion::PARQUET_816_FIXED_VERSION()));
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups(row_groups, column_indices, &expected));
+  }
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_pre_buffer(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups(row_groups, column_indices, &actual));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *actual));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -18,7 +18,10 @@
 #include "parquet/arrow/reader.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -131,6 +134,15 @@ class FileReaderImpl : public FileReader {
     return Status::OK();
   }
 
+  // Read the given column chunks of the given row groups ahead, coalescing reads.
+  // Can throw exception
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) {
+    reader_->PreBuffer(row_groups, column_indices,
+                       reader_properties_.pre_buffer_hole_size_limit(),
+                       reader_properties_.pre_buffer_range_size_limit());
+  }
+
   Status BoundsCheckRowGroup(int row_group) {
     // row group indices check
     if (row_group < 0 || row_group >= num_row_groups()) {
@@ -163,13 +175,15 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        std::shared_ptr<const RowRanges> row_ranges = NULLPTR) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
     ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->row_ranges = std::move(row_ranges);
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -270,6 +284,10 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Status GetRecordBatchReader(int row_group_index, const RowRanges& row_ranges,
+                              const std::vector<int>& column_indices,
+                              std::unique_ptr<RecordBatchReader>* out) override;
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -298,19 +316,35 @@ class FileReaderImpl : public FileReader {
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size,
+                            bool use_threads, int32_t batch_readahead)
       : field_readers_(std::move(field_readers)),
         schema_(std::move(schema)),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        use_threads_(use_threads),
+        batch_readahead_(std::max(batch_readahead, 0)) {
+    if (use_threads_) {
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        readaheads_.emplace_back(new ColumnReadahead());
+      }
+    }
+  }
 
-  ~RowGroupRecordBatchReader() override {}
+  ~RowGroupRecordBatchReader() override {
+    // The decoding tasks use the field readers
+    for (auto& readahead : readaheads_) {
+      std::unique_lock<std::mutex> lock(readahead->mutex);
+      readahead->cv.wait(lock, [&] { return !readahead->decoding; });
+    }
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
   static Status Make(const std::vector<int>& row_groups,
                      const std::vector<int>& column_indices, FileReaderImpl* reader,
-                     int64_t batch_size,
-                     std::unique_ptr<::arrow::RecordBatchReader>* out) {
+                     const ArrowReaderProperties& properties,
+                     std::unique_ptr<::arrow::RecordBatchReader>* out,
+                     std::shared_ptr<const RowRanges> row_ranges = NULLPTR) {
     std::vector<int> field_indices;
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
       return Status::Invalid("Invalid column index");
@@ -321,21 +355,44 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     auto included_leaves = VectorToSharedSet(column_indices);
     for (size_t i = 0; i < field_indices.size(); ++i) {
       RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], included_leaves, row_groups,
-                                           &field_readers[i]));
+                                           &field_readers[i], row_ranges));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), properties.batch_size(),
+        properties.use_threads(), properties.batch_readahead()));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
-    for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
+    if (use_threads_) {
+      ScheduleReadahead();
+      for (size_t i = 0; i < readaheads_.size(); ++i) {
+        ColumnReadahead* readahead = readaheads_[i].get();
+        std::unique_lock<std::mutex> lock(readahead->mutex);
+        readahead->cv.wait(lock, [&] {
+          return !readahead->batches.empty() || !readahead->decoding;
+        });
+        if (readahead->batches.empty()) {
+          RETURN_NOT_OK(readahead->status);
+          // The column is exhausted
+          *out = nullptr;
+          return Status::OK();
+        }
+        columns[i] = std::move(readahead->batches.front());
+        readahead->batches.pop_front();
+      }
+      // Decode the next batches while this one is consumed
+      ScheduleReadahead();
+    } else {
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
+      }
+    }
+
+    for (const auto& column : columns) {
+      if (column->num_chunks() > 1) {
         return Status::NotImplemented("This class cannot yet iterate chunked arrays");
       }
     }
@@ -349,9 +406,71 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   }
 
  private:
+  // The batches of a column decoded ahead on the CPU thread pool. Column
+  // readers aren't thread-safe, so a single task at a time decodes the
+  // batches of a column, in order.
+  struct ColumnReadahead {
+    std::mutex mutex;
+    std::condition_variable cv;
+    // Decoded and not returned yet
+    std::deque<std::shared_ptr<ChunkedArray>> batches;
+    Status status;
+    bool decoding = false;
+    bool exhausted = false;
+  };
+
+  // Start decoding the batches of the columns up to batch_readahead_ batches
+  // ahead of the next batch returned
+  void ScheduleReadahead() {
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    for (size_t i = 0; i < readaheads_.size(); ++i) {
+      ColumnReadahead* readahead = readaheads_[i].get();
+      std::lock_guard<std::mutex> lock(readahead->mutex);
+      const int64_t num_batches =
+          batch_readahead_ + 1 - static_cast<int64_t>(readahead->batches.size());
+      if (readahead->decoding || readahead->exhausted || !readahead->status.ok() ||
+          num_batches <= 0) {
+        continue;
+      }
+      ColumnReaderImpl* reader = field_readers_[i].get();
+      const int64_t batch_size = batch_size_;
+      readahead->decoding = true;
+      Status st = pool->Spawn([readahead, reader, batch_size, num_batches] {
+        for (int64_t n = 0; n < num_batches; ++n) {
+          std::shared_ptr<ChunkedArray> batch;
+          Status st = reader->NextBatch(batch_size, &batch);
+          std::lock_guard<std::mutex> lock(readahead->mutex);
+          if (st.ok()) {
+            readahead->exhausted = batch->length() == 0;
+            readahead->batches.push_back(std::move(batch));
+          } else {
+            readahead->status = std::move(st);
+          }
+          const bool done =
+              !readahead->status.ok() || readahead->exhausted || n + 1 == num_batches;
+          if (done) {
+            readahead->decoding = false;
+          }
+          readahead->cv.notify_all();
+          if (done) {
+            return;
+          }
+        }
+      });
+      if (!st.ok()) {
+        readahead->status = std::move(st);
+        readahead->decoding = false;
+      }
+    }
+  }
+
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  bool use_threads_;
+  int32_t batch_readahead_;
+  // One per field reader if use_threads_
+  std::vector<std::unique_ptr<ColumnReadahead>> readaheads_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -430,7 +549,9 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = ctx_->row_ranges
+                                 ? ReadSelectedRecords(records_to_read)
+                                 : record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -453,11 +574,40 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Read up to num_records of the rows within the row ranges of the context,
+  // skipping the rows before them. Returns 0 past the last row range
+  int64_t ReadSelectedRecords(int64_t num_records) {
+    const RowRanges& row_ranges = *ctx_->row_ranges;
+    while (next_range_ < row_ranges.size()) {
+      const RowRange& range = row_ranges[next_range_];
+      if (current_row_ < range.start) {
+        const int64_t records_skipped =
+            record_reader_->SkipRecords(range.start - current_row_);
+        current_row_ += records_skipped;
+        if (current_row_ < range.start) {
+          // The column chunk ended early
+          return 0;
+        }
+      }
+      const int64_t records_read =
+          record_reader_->ReadRecords(std::min(num_records, range.end - current_row_));
+      current_row_ += records_read;
+      if (current_row_ == range.end) {
+        ++next_range_;
+      }
+      return records_read;
+    }
+    return 0;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // Position in the row group when reading row ranges
+  int64_t current_row_ = 0;
+  size_t next_range_ = 0;
 };
 
 class NestedListReader : public ColumnReaderImpl {
@@ -773,8 +923,43 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
+  if (reader_properties_.pre_buffer()) {
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    PreBuffer(row_group_indices, column_indices);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
-                                         reader_properties_.batch_size(), out);
+                                         reader_properties_, out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(int row_group_index,
+                                            const RowRanges& row_ranges,
+                                            const std::vector<int>& column_indices,
+                                            std::unique_ptr<RecordBatchReader>* out) {
+  RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
+  const int64_t num_rows = reader_->metadata()->RowGroup(row_group_index)->num_rows();
+  int64_t previous_end = 0;
+  for (const RowRange& range : row_ranges) {
+    if (range.start < previous_end || range.end <= range.start || range.end > num_rows) {
+      return Status::Invalid("Row ranges must be sorted, disjoint and non-empty ranges ",
+                             "within the ", num_rows, " rows of the row group");
+    }
+    previous_end = range.end;
+  }
+  if (reader_properties_.pre_buffer()) {
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    PreBuffer({row_group_index}, column_indices);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+  return RowGroupRecordBatchReader::Make({row_group_index}, column_indices, this,
+                                         reader_properties_, out,
+                                         std::make_shared<const RowRanges>(row_ranges));
 }
 
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
@@ -803,6 +988,10 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  if (reader_properties_.pre_buffer()) {
+    PreBuffer(row_groups, indices);
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
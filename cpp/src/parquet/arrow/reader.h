@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -172,6 +173,20 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a RecordBatchReader of the rows of a row group within
+  ///     row_ranges, whose columns are selected by column_indices. The other
+  ///     rows are skipped in all the columns, and the data pages of the
+  ///     non-repeated columns which hold none of the selected rows aren't
+  ///     decompressed. See parquet::PageRowRanges to select rows with the
+  ///     page index of a row group.
+  /// \returns error Status if row_group_index or column_indices contains an
+  ///    invalid index, or row_ranges are not sorted, disjoint ranges of the
+  ///    rows of the row group
+  virtual ::arrow::Status GetRecordBatchReader(
+      int row_group_index, const RowRanges& row_ranges,
+      const std::vector<int>& column_indices,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -208,7 +223,10 @@ class PARQUET_EXPORT FileReader {
   virtual ParquetFileReader* parquet_reader() const = 0;
 
   /// Set whether to use multiple threads during reads of multiple columns.
-  /// By default only one thread is used.
+  /// By default only one thread is used. With multiple threads, RecordBatchReaders
+  /// decode their columns in parallel, ahead of the batch they return (see
+  /// ArrowReaderProperties::set_batch_readahead).
+  /// Call this before creating the RecordBatchReaders.
   virtual void set_use_threads(bool use_threads) = 0;
 
   virtual ~FileReader() = default;
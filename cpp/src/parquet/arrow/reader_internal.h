@@ -31,6 +31,7 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -117,6 +118,8 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  // The rows to read of the single row group read, or null to read all rows
+  std::shared_ptr<const RowRanges> row_ranges;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
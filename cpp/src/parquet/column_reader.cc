@@ -140,7 +140,14 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_data_page_filter(DataPageFilter filter) override {
+    data_page_filter_ = std::move(filter);
+  }
+
  private:
+  // Whether the data page filter skips the page of the current header
+  bool ShouldSkipPage();
+
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
 
@@ -176,6 +183,8 @@ class SerializedPageReader : public PageReader {
   // Number of rows in all the data pages
   int64_t total_num_rows_;
 
+  DataPageFilter data_page_filter_;
+
   // data_page_aad_ and data_page_header_aad_ contain the AAD for data page and data page
   // header in a single column respectively.
   // While calculating AAD for different pages in a single column the pages AAD is
@@ -217,6 +226,52 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
   }
 }
 
+template <typename H>
+EncodedStatistics ExtractStatsFromHeader(const H& header) {
+  EncodedStatistics page_statistics;
+  if (!header.__isset.statistics) {
+    return page_statistics;
+  }
+  const format::Statistics& stats = header.statistics;
+  if (stats.__isset.max) {
+    page_statistics.set_max(stats.max);
+  }
+  if (stats.__isset.min) {
+    page_statistics.set_min(stats.min);
+  }
+  if (stats.__isset.null_count) {
+    page_statistics.set_null_count(stats.null_count);
+  }
+  if (stats.__isset.distinct_count) {
+    page_statistics.set_distinct_count(stats.distinct_count);
+  }
+  return page_statistics;
+}
+
+bool SerializedPageReader::ShouldSkipPage() {
+  EncodedStatistics page_statistics;
+  int32_t num_values;
+  switch (LoadEnumSafe(&current_page_header_.type)) {
+    case PageType::DATA_PAGE:
+      page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header);
+      num_values = current_page_header_.data_page_header.num_values;
+      break;
+    case PageType::DATA_PAGE_V2:
+      page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header_v2);
+      num_values = current_page_header_.data_page_header_v2.num_values;
+      break;
+    default:
+      return false;
+  }
+  if (!data_page_filter_(DataPageStats{&page_statistics, num_values})) {
+    return false;
+  }
+  // A skipped page still counts, for the AAD of the next pages and the rows seen
+  ++page_ordinal_;
+  seen_num_rows_ += num_values;
+  return true;
+}
+
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
@@ -260,6 +315,10 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
+    if (data_page_filter_ && ShouldSkipPage()) {
+      PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      continue;
+    }
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -310,22 +369,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
 
-      EncodedStatistics page_statistics;
-      if (header.__isset.statistics) {
-        const format::Statistics& stats = header.statistics;
-        if (stats.__isset.max) {
-          page_statistics.set_max(stats.max);
-        }
-        if (stats.__isset.min) {
-          page_statistics.set_min(stats.min);
-        }
-        if (stats.__isset.null_count) {
-          page_statistics.set_null_count(stats.null_count);
-        }
-        if (stats.__isset.distinct_count) {
-          page_statistics.set_distinct_count(stats.distinct_count);
-        }
-      }
+      EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
 
       seen_num_rows_ += header.num_values;
 
@@ -990,6 +1034,63 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    int64_t records_skipped = 0;
+
+    if (levels_position_ < levels_written_) {
+      records_skipped += SkipBufferedRecords(num_records);
+    }
+
+    // As in ReadRecords, a record started is skipped to its end
+    while (!at_record_start_ || records_skipped < num_records) {
+      if (this->max_rep_level_ == 0 && available_values_current_page() == 0) {
+        // Between pages, and each level is a row
+        records_skipped += SkipPages(num_records - records_skipped);
+        if (records_skipped == num_records) {
+          break;
+        }
+      }
+
+      if (!this->HasNextInternal()) {
+        if (!at_record_start_) {
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+
+      int64_t batch_size = std::min(kMinLevelBatchSize, available_values_current_page());
+      if (this->max_def_level_ > 0) {
+        ReserveLevels(batch_size);
+
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        int16_t* rep_levels = this->rep_levels() + levels_written_;
+
+        int64_t levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+        if (this->max_rep_level_ > 0 &&
+            this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+          throw ParquetException("Number of decoded rep / def levels did not match");
+        }
+
+        // Exhausted column chunk
+        if (levels_read == 0) {
+          break;
+        }
+
+        levels_written_ += levels_read;
+        records_skipped += SkipBufferedRecords(num_records - records_skipped);
+      } else {
+        // No repetition or definition levels
+        batch_size = std::min(num_records - records_skipped, batch_size);
+        SkipValues(batch_size);
+        this->ConsumeBufferedValues(batch_size);
+        records_skipped += batch_size;
+      }
+    }
+
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1062,6 +1163,83 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  // Skip records whose levels were already decoded, dropping their levels
+  // while keeping those of the records before and after them
+  //
+  // \return Number of records skipped
+  int64_t SkipBufferedRecords(int64_t num_records) {
+    const int64_t start_levels_position = levels_position_;
+
+    int64_t values_to_skip = 0;
+    int64_t records_skipped = 0;
+    if (this->max_rep_level_ > 0) {
+      records_skipped = DelimitRecords(num_records, &values_to_skip);
+    } else {
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      const int16_t* def_levels = this->def_levels() + levels_position_;
+      for (int64_t i = 0; i < records_skipped; ++i) {
+        if (def_levels[i] == this->max_def_level_) {
+          ++values_to_skip;
+        }
+      }
+      levels_position_ += records_skipped;
+    }
+    SkipValues(values_to_skip);
+
+    const int64_t levels_skipped = levels_position_ - start_levels_position;
+    this->ConsumeBufferedValues(levels_skipped);
+
+    int16_t* def_data = this->def_levels();
+    std::copy(def_data + levels_position_, def_data + levels_written_,
+              def_data + start_levels_position);
+    if (this->max_rep_level_ > 0) {
+      int16_t* rep_data = this->rep_levels();
+      std::copy(rep_data + levels_position_, rep_data + levels_written_,
+                rep_data + start_levels_position);
+    }
+    levels_written_ -= levels_skipped;
+    levels_position_ = start_levels_position;
+    return records_skipped;
+  }
+
+  // Skip the next data pages of a non-repeated column while they hold no more
+  // than num_records rows, without decompressing them, then load the next one
+  //
+  // \return Number of records skipped
+  int64_t SkipPages(int64_t num_records) {
+    int64_t records_skipped = 0;
+    this->pager_->set_data_page_filter([&](const DataPageStats& stats) {
+      if (records_skipped + stats.num_values > num_records) {
+        return false;
+      }
+      records_skipped += stats.num_values;
+      return true;
+    });
+    this->HasNextInternal();
+    this->pager_->set_data_page_filter(nullptr);
+    return records_skipped;
+  }
+
+  // Decode the next values of the current page and drop them
+  void SkipValues(int64_t num_values) {
+    if (num_values == 0) {
+      return;
+    }
+    if (skip_buffer_ == nullptr) {
+      skip_buffer_ = AllocateBuffer(this->pool_);
+    }
+    const int64_t batch_size = std::min(kMinLevelBatchSize, num_values);
+    PARQUET_THROW_NOT_OK(skip_buffer_->Resize(batch_size * sizeof(T), false));
+    T* values = reinterpret_cast<T*>(skip_buffer_->mutable_data());
+    while (num_values > 0) {
+      const int values_to_decode = static_cast<int>(std::min(batch_size, num_values));
+      if (this->current_decoder_->Decode(values, values_to_decode) != values_to_decode) {
+        throw ParquetException("Could not decode the values to skip");
+      }
+      num_values -= values_to_decode;
+    }
+  }
+
   void Reserve(int64_t capacity) override {
     ReserveLevels(capacity);
     ReserveValues(capacity);
@@ -1263,6 +1441,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  // Scratch space for the values decoded to be skipped
+  std::shared_ptr<ResizableBuffer> skip_buffer_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -45,6 +46,7 @@ class RleDecoder;
 namespace parquet {
 
 class Decryptor;
+class EncodedStatistics;
 class Page;
 
 // 16 MB is the default maximum page header size
@@ -91,10 +93,22 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+// What is known of a data page from its header, before its data is read
+struct PARQUET_EXPORT DataPageStats {
+  // The statistics of the page, which may be unset
+  const EncodedStatistics* encoded_statistics;
+  // The number of values of the page, including nulls. For non-repeated
+  // columns, this is its number of rows.
+  int32_t num_values;
+};
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
  public:
+  // Returns true for the data pages to skip
+  using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
   virtual ~PageReader() = default;
 
   static std::unique_ptr<PageReader> Open(
@@ -107,6 +121,11 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Skip the data pages for which filter returns true in NextPage, without
+  // reading or decompressing their data. Dictionary pages are never skipped.
+  // Implementations which can't skip pages may ignore the filter.
+  virtual void set_data_page_filter(DataPageFilter filter) {}
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -215,6 +234,12 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records of the column chunk, dropping
+  /// any of their levels and values already decoded. Pages holding only
+  /// skipped rows of a non-repeated column aren't decompressed nor decoded.
+  /// \return number of records skipped, fewer only at the end of the column chunk
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
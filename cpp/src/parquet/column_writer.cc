@@ -37,11 +37,13 @@
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -508,13 +510,15 @@ class ColumnWriterImpl {
  public:
   ColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                    std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                   Encoding::type encoding, const WriterProperties* properties)
+                   Encoding::type encoding, const WriterProperties* properties,
+                   PageIndexBuilder* page_index_builder)
       : metadata_(metadata),
         descr_(metadata->descr()),
         pager_(std::move(pager)),
         has_dictionary_(use_dictionary),
         encoding_(encoding),
         properties_(properties),
+        page_index_builder_(page_index_builder),
         allocator_(properties->memory_pool()),
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
@@ -562,7 +566,12 @@ class ColumnWriterImpl {
 
   // Serializes Data Pages
   void WriteDataPage(const CompressedDataPage& page) {
-    total_bytes_written_ += pager_->WriteDataPage(page);
+    int64_t bytes_written = pager_->WriteDataPage(page);
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->AddPageLocation(total_bytes_written_,
+                                           static_cast<int32_t>(bytes_written));
+    }
+    total_bytes_written_ += bytes_written;
   }
 
   // Write multiple definition levels
@@ -595,6 +604,9 @@ class ColumnWriterImpl {
   Encoding::type encoding_;
   const WriterProperties* properties_;
 
+  // Collects the page index of the column chunk, if one is written
+  PageIndexBuilder* page_index_builder_;
+
   LevelEncoder level_encoder_;
 
   MemoryPool* allocator_;
@@ -706,6 +718,12 @@ void ColumnWriterImpl::AddDataPage() {
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
 
+  if (page_index_builder_ != nullptr) {
+    // Only non-repeated columns have page indexes, so each level is a row
+    page_index_builder_->AddPage(page_stats, num_buffered_values_,
+                                 rows_written_ - num_buffered_values_);
+  }
+
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
     pager_->Compress(*(uncompressed_data_.get()), compressed_data_.get());
@@ -757,6 +775,14 @@ int64_t ColumnWriterImpl::Close() {
       metadata_->SetStatistics(chunk_statistics);
     }
     pager_->Close(has_dictionary_, fallback_);
+
+    if (page_index_builder_ != nullptr) {
+      // The pages were located from the first byte of the column chunk
+      auto chunk_metadata = ColumnChunkMetaData::Make(metadata_->contents(), descr_);
+      page_index_builder_->Finish(chunk_metadata->has_dictionary_page()
+                                      ? chunk_metadata->dictionary_page_offset()
+                                      : chunk_metadata->data_page_offset());
+    }
   }
 
   return total_bytes_written_;
@@ -821,6 +847,51 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// The hash of a value in a bloom filter, as the hash of its plain encoding
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, int32_t value) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, int64_t value) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, float value) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, double value) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, const Int96& value) {
+  return filter.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor*, const ByteArray& value) {
+  return filter.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                       const ColumnDescriptor* descr,
+                                       const FLBA& value) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
+// Boolean columns have no bloom filter
+static inline uint64_t BloomFilterHash(const BloomFilter&, const ColumnDescriptor*,
+                                       bool) {
+  DCHECK(false);
+  return 0;
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -828,9 +899,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter, PageIndexBuilder* page_index_builder)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties, page_index_builder),
+        bloom_filter_(bloom_filter) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
 
@@ -1112,6 +1185,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; i++) {
+        bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1129,7 +1207,27 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (descr_->schema_node()->is_optional()) {
+        ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                          num_spaced_values);
+        for (int64_t i = 0; i < num_spaced_values; i++) {
+          if (valid_bits_reader.IsSet()) {
+            bloom_filter_->InsertHash(
+                BloomFilterHash(*bloom_filter_, descr_, values[i]));
+          }
+          valid_bits_reader.Next();
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; i++) {
+          bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+        }
+      }
+    }
   }
+
+  // The bloom filter of the column chunk, or null
+  BloomFilter* bloom_filter_;
 };
 
 template <typename DType>
@@ -1161,13 +1259,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. The bloom filter needs the
+    // values of the indices, so it is written densely too.
     return WriteDense();
   }
 
@@ -1612,6 +1711,17 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      const auto& binary_slice = checked_cast<const ::arrow::BinaryArray&>(*data_slice);
+      for (int64_t i = 0; i < binary_slice.length(); i++) {
+        if (binary_slice.IsValid(i)) {
+          const auto view = binary_slice.GetView(i);
+          const ByteArray value(static_cast<uint32_t>(view.size()),
+                                reinterpret_cast<const uint8_t*>(view.data()));
+          bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+        }
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -1725,7 +1835,9 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(const int16_t* def_level
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter,
+                                                 PageIndexBuilder* page_index_builder) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -1736,28 +1848,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties, bloom_filter,
+          page_index_builder);
     default:
       ParquetException::NYI("type reader not implemented");
   }
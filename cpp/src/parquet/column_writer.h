@@ -42,6 +42,8 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
+class PageIndexBuilder;
 class ColumnDescriptor;
 class CompressedDataPage;
 class DictionaryPage;
@@ -111,9 +113,14 @@ class PARQUET_EXPORT ColumnWriter {
  public:
   virtual ~ColumnWriter() = default;
 
-  static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
-                                            std::unique_ptr<PageWriter>,
-                                            const WriterProperties* properties);
+  /// \brief Make a writer for a column chunk. If bloom_filter is given, the
+  /// hashes of the values written are inserted into it, and if
+  /// page_index_builder is given, the data pages written are added to it. Both
+  /// must outlive the writer.
+  static std::shared_ptr<ColumnWriter> Make(
+      ColumnChunkMetaDataBuilder*, std::unique_ptr<PageWriter>,
+      const WriterProperties* properties, BloomFilter* bloom_filter = NULLPTR,
+      PageIndexBuilder* page_index_builder = NULLPTR);
 
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
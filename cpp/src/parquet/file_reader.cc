@@ -23,11 +23,16 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -36,6 +41,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -75,21 +81,84 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int) {
+  return nullptr;
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int) {
+  return nullptr;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int) {
+  return nullptr;
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+// The byte range of a column chunk in the file
+static ::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                                      int64_t source_size,
+                                                      const ColumnChunkMetaData& col) {
+  int64_t col_start = col.data_page_offset();
+  if (col.has_dictionary_page() && col.dictionary_page_offset() > 0 &&
+      col_start > col.dictionary_page_offset()) {
+    col_start = col.dictionary_page_offset();
+  }
+
+  int64_t col_length = col.total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t bytes_remaining = source_size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
-  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source, int64_t source_size,
-                     FileMetaData* file_metadata, int row_group_number,
-                     const ReaderProperties& props,
+  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source,
+                     std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
+                     int64_t source_size, FileMetaData* file_metadata,
+                     int row_group_number, const ReaderProperties& props,
+                     std::vector<::arrow::io::ReadRange> prebuffered_column_chunks,
                      std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
       : source_(std::move(source)),
+        cached_source_(std::move(cached_source)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(props),
         row_group_ordinal_(row_group_number),
+        prebuffered_column_chunks_(std::move(prebuffered_column_chunks)),
         file_decryptor_(file_decryptor) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
@@ -99,31 +168,22 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   const ReaderProperties* properties() const override { return &properties_; }
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
-    // Read column chunk from the file
+    // Read column chunk from the file, or from memory if it was pre-buffered
     auto col = row_group_metadata_->ColumnChunk(i);
-
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t bytes_remaining = source_size_ - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    const ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, *col);
+
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ && i < static_cast<int>(prebuffered_column_chunks_.size()) &&
+        prebuffered_column_chunks_[i].length > 0) {
+      // The pre-buffered range may be shorter than col_range, see PreBuffer
+      PARQUET_ASSIGN_OR_THROW(auto buffer,
+                              cached_source_->Read(prebuffered_column_chunks_[i]));
+      stream = std::make_shared<::arrow::io::BufferReader>(buffer);
+    } else {
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
@@ -164,14 +224,85 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Encrypted files are written without bloom filters
+    if (!col->has_bloom_filter() || col->crypto_metadata() != nullptr) {
+      return nullptr;
+    }
+
+    // The header of a bloom filter is the size of its bitset, its hash
+    // strategy and its algorithm
+    constexpr int64_t kHeaderSize = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kHeaderSize > source_size_) {
+      throw ParquetException("Invalid bloom filter offset " + std::to_string(offset));
+    }
+    PARQUET_ASSIGN_OR_THROW(auto header, source_->ReadAt(offset, kHeaderSize));
+    if (header->size() != kHeaderSize) {
+      throw ParquetException("Could not read bloom filter header");
+    }
+    const auto bitset_size = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (bitset_size > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + kHeaderSize + bitset_size > source_size_) {
+      throw ParquetException("Invalid bloom filter size " +
+                             std::to_string(bitset_size));
+    }
+
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(offset, kHeaderSize + bitset_size));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Encrypted files are written without page indexes
+    if (!col->has_column_index() || col->crypto_metadata() != nullptr) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->column_index_offset(), col->column_index_length());
+    uint32_t len = static_cast<uint32_t>(buffer->size());
+    return std::unique_ptr<ColumnIndex>(
+        new ColumnIndex(ColumnIndex::Deserialize(buffer->data(), &len)));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index() || col->crypto_metadata() != nullptr) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->offset_index_offset(), col->offset_index_length());
+    uint32_t len = static_cast<uint32_t>(buffer->size());
+    return std::unique_ptr<OffsetIndex>(
+        new OffsetIndex(OffsetIndex::Deserialize(buffer->data(), &len)));
+  }
+
  private:
   std::shared_ptr<ArrowInputFile> source_;
+  // Pre-buffered column chunks
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
   int64_t source_size_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
   int16_t row_group_ordinal_;
+  // The pre-buffered range of each column chunk, empty if not pre-buffered
+  std::vector<::arrow::io::ReadRange> prebuffered_column_chunks_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+
+  std::shared_ptr<Buffer> ReadPageIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length <= 0 || offset + length > source_size_) {
+      throw ParquetException("Invalid page index location " + std::to_string(offset) +
+                             ", length " + std::to_string(length));
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetException("Could not read page index");
+    }
+    return buffer;
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -200,12 +331,61 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, source_size_, file_metadata_.get(),
-                               static_cast<int16_t>(i), properties_, file_decryptor_));
+    std::vector<::arrow::io::ReadRange> prebuffered_column_chunks;
+    auto it = prebuffered_column_chunks_.find(i);
+    if (it != prebuffered_column_chunks_.end()) {
+      prebuffered_column_chunks = it->second;
+    }
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, cached_source_, source_size_, file_metadata_.get(),
+        static_cast<int16_t>(i), properties_, std::move(prebuffered_column_chunks),
+        file_decryptor_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices, int64_t hole_size_limit,
+                 int64_t range_size_limit) override {
+    cached_source_ = std::make_shared<::arrow::io::internal::ReadRangeCache>(
+        source_, hole_size_limit, range_size_limit);
+    prebuffered_column_chunks_.clear();
+
+    // The cache requires the ranges not to overlap, so skip repeated indices
+    std::vector<::arrow::io::ReadRange*> ranges;
+    const int num_columns = file_metadata_->num_columns();
+    for (int row_group : row_groups) {
+      auto& prebuffered = prebuffered_column_chunks_[row_group];
+      prebuffered.resize(num_columns, ::arrow::io::ReadRange{0, 0});
+      auto row_group_metadata = file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        if (prebuffered[column].length > 0) {
+          continue;
+        }
+        auto col = row_group_metadata->ColumnChunk(column);
+        prebuffered[column] =
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, *col);
+        ranges.push_back(&prebuffered[column]);
+      }
+    }
+
+    // The PARQUET-816 padding of the ranges of old files may run into the next
+    // column chunk, while the column chunk itself ends before it
+    using ::arrow::io::ReadRange;
+    std::sort(ranges.begin(), ranges.end(),
+              [](const ReadRange* left, const ReadRange* right) {
+                return left->offset < right->offset;
+              });
+    std::vector<::arrow::io::ReadRange> cached_ranges;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (i + 1 < ranges.size()) {
+        ranges[i]->length =
+            std::min(ranges[i]->length, ranges[i + 1]->offset - ranges[i]->offset);
+      }
+      cached_ranges.push_back(*ranges[i]);
+    }
+    PARQUET_THROW_NOT_OK(cached_source_->Cache(std::move(cached_ranges)));
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(std::shared_ptr<FileMetaData> metadata) {
@@ -267,6 +447,10 @@ class SerializedFile : public ParquetFileReader::Contents {
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
 
+  // Pre-buffered column chunks, by row group and column
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  std::unordered_map<int, std::vector<::arrow::io::ReadRange>> prebuffered_column_chunks_;
+
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
   void ParseUnencryptedFileMetadata(const std::shared_ptr<Buffer>& footer_buffer,
@@ -536,6 +720,28 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   return contents_->GetRowGroup(i);
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  int64_t hole_size_limit, int64_t range_size_limit) {
+  for (int row_group : row_groups) {
+    if (row_group < 0 || row_group >= metadata()->num_row_groups()) {
+      throw ParquetException("The file only has " +
+                             std::to_string(metadata()->num_row_groups()) +
+                             " row groups, requested pre-buffering of: " +
+                             std::to_string(row_group));
+    }
+  }
+  for (int column : column_indices) {
+    if (column < 0 || column >= metadata()->num_columns()) {
+      throw ParquetException("The file only has " +
+                             std::to_string(metadata()->num_columns()) +
+                             " columns, requested pre-buffering of: " +
+                             std::to_string(column));
+    }
+  }
+  contents_->PreBuffer(row_groups, column_indices, hole_size_limit, range_size_limit);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
@@ -28,8 +28,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+struct ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+struct OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -44,6 +47,11 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // Contents not backed by a file may have no bloom filters
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    // Likewise for page indexes
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -57,6 +65,17 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the bloom filter of the indicated row group-relative column, or
+  // return null if the column chunk has none. A value whose hash isn't found
+  // in the filter is not in the column chunk.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the page index of the indicated row group-relative column, or return
+  // null if the column chunk has none. The ColumnIndex has the bounds of the
+  // values of each data page, the OffsetIndex their locations and first rows.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -78,6 +97,11 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    // Start reading the given column chunks ahead of GetRowGroup, see
+    // ParquetFileReader::PreBuffer. Contents not backed by a file may ignore this.
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices,
+                           int64_t hole_size_limit, int64_t range_size_limit) {}
   };
 
   ParquetFileReader();
@@ -117,6 +141,20 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Pre-buffer the given column chunks of the given row groups
+  ///
+  /// The byte ranges of all the column chunks are computed up front, ranges
+  /// less than hole_size_limit bytes apart are coalesced (up to
+  /// range_size_limit bytes), and the coalesced ranges are read concurrently in
+  /// the background. Row groups returned by RowGroup() afterwards read these
+  /// column chunks from memory, waiting for their reads to complete if needed.
+  ///
+  /// This replaces any previously pre-buffered column chunks, and must not be
+  /// called while column chunks are being read.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices, int64_t hole_size_limit,
+                 int64_t range_size_limit);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -15,14 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_compat.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -398,6 +402,162 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+TEST(TestBloomFilterWriter, RoundTrip) {
+  const int kRowGroups = 3;
+  const int kValueCount = 1000;
+  auto sink = CreateOutputStream();
+  auto writer_props = parquet::WriterProperties::Builder()
+                          .enable_bloom_filter("with_filter")
+                          ->disable_bloom_filter("without_filter")
+                          ->build();
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("with_filter", parquet::Repetition::OPTIONAL,
+                                       parquet::Type::INT64));
+  fields.push_back(PrimitiveNode::Make("without_filter", parquet::Repetition::REQUIRED,
+                                       parquet::Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+  std::vector<int64_t> values(kValueCount);
+  std::vector<int16_t> def_levels(kValueCount);
+  for (int r = 0; r < kRowGroups; ++r) {
+    // Row group r holds the even values of [r * 2000, (r + 1) * 2000), nulls
+    // standing for the multiples of 10
+    for (int i = 0; i < kValueCount; ++i) {
+      values[i] = r * 2 * kValueCount + 2 * i;
+      def_levels[i] = values[i] % 10 == 0 ? 0 : 1;
+    }
+    auto rg_writer = file_writer->AppendRowGroup();
+    auto col_writer = static_cast<Int64Writer*>(rg_writer->NextColumn());
+    std::vector<uint8_t> valid_bits(kValueCount / 8 + 1, 0);
+    for (int i = 0; i < kValueCount; ++i) {
+      if (def_levels[i]) {
+        ::arrow::BitUtil::SetBit(valid_bits.data(), i);
+      }
+    }
+    col_writer->WriteBatchSpaced(kValueCount, def_levels.data(), nullptr,
+                                 valid_bits.data(), 0, values.data());
+    col_writer = static_cast<Int64Writer*>(rg_writer->NextColumn());
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values.data());
+    rg_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  ASSERT_EQ(kRowGroups, file_reader->metadata()->num_row_groups());
+  for (int r = 0; r < kRowGroups; ++r) {
+    auto rg_reader = file_reader->RowGroup(r);
+    ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(1));
+
+    std::unique_ptr<BloomFilter> bloom_filter = rg_reader->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+    int false_positives = 0;
+    for (int64_t value = 0; value < kRowGroups * 2 * kValueCount; ++value) {
+      const bool written =
+          value / (2 * kValueCount) == r && value % 2 == 0 && value % 10 != 0;
+      const bool found = bloom_filter->FindHash(bloom_filter->Hash(value));
+      if (written) {
+        ASSERT_TRUE(found) << value;
+      } else {
+        false_positives += found;
+      }
+    }
+    // The default false positive probability is 5%
+    ASSERT_LT(false_positives, kRowGroups * 2 * kValueCount / 20);
+  }
+}
+
+TEST(TestPageIndexWriter, RoundTrip) {
+  const int kNumPages = 10;
+  const int kRowsPerPage = 100;
+  const int kValueCount = kNumPages * kRowsPerPage;
+  auto sink = CreateOutputStream();
+  // Cut a page after each batch of kRowsPerPage values
+  auto writer_props = parquet::WriterProperties::Builder()
+                          .enable_page_index("with_index")
+                          ->disable_dictionary()
+                          ->write_batch_size(kRowsPerPage)
+                          ->data_pagesize(1)
+                          ->build();
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("with_index", parquet::Repetition::REQUIRED,
+                                       parquet::Type::INT64));
+  fields.push_back(PrimitiveNode::Make("without_index", parquet::Repetition::REQUIRED,
+                                       parquet::Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+  std::vector<int64_t> values(kValueCount);
+  for (int i = 0; i < kValueCount; ++i) {
+    values[i] = 2 * i;
+  }
+  auto rg_writer = file_writer->AppendRowGroup();
+  for (int c = 0; c < 2; ++c) {
+    auto col_writer = static_cast<Int64Writer*>(rg_writer->NextColumn());
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values.data());
+  }
+  rg_writer->Close();
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+  auto file_reader = ParquetFileReader::Open(source);
+  auto rg_reader = file_reader->RowGroup(0);
+  auto column_chunk = rg_reader->metadata()->ColumnChunk(0);
+  ASSERT_TRUE(column_chunk->has_column_index());
+  ASSERT_TRUE(column_chunk->has_offset_index());
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_column_index());
+  ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_offset_index());
+  ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(1));
+  ASSERT_EQ(nullptr, rg_reader->GetOffsetIndex(1));
+
+  std::unique_ptr<OffsetIndex> offset_index = rg_reader->GetOffsetIndex(0);
+  ASSERT_NE(nullptr, offset_index);
+  ASSERT_EQ(kNumPages, offset_index->page_locations.size());
+  ASSERT_EQ(column_chunk->data_page_offset(), offset_index->page_locations[0].offset);
+  for (int i = 0; i < kNumPages; ++i) {
+    const PageLocation& location = offset_index->page_locations[i];
+    ASSERT_EQ(i * kRowsPerPage, location.first_row_index);
+    if (i > 0) {
+      const PageLocation& previous = offset_index->page_locations[i - 1];
+      ASSERT_EQ(previous.offset + previous.compressed_page_size, location.offset);
+    }
+  }
+
+  std::unique_ptr<ColumnIndex> column_index = rg_reader->GetColumnIndex(0);
+  ASSERT_NE(nullptr, column_index);
+  ASSERT_EQ(BoundaryOrder::ASCENDING, column_index->boundary_order);
+  ASSERT_EQ(kNumPages, column_index->null_pages.size());
+  ASSERT_EQ(kNumPages, column_index->null_counts.size());
+  for (int i = 0; i < kNumPages; ++i) {
+    ASSERT_FALSE(column_index->null_pages[i]);
+    ASSERT_EQ(0, column_index->null_counts[i]);
+    int64_t min, max;
+    ASSERT_EQ(sizeof(int64_t), column_index->min_values[i].size());
+    ASSERT_EQ(sizeof(int64_t), column_index->max_values[i].size());
+    std::memcpy(&min, column_index->min_values[i].data(), sizeof(int64_t));
+    std::memcpy(&max, column_index->max_values[i].data(), sizeof(int64_t));
+    ASSERT_EQ(values[i * kRowsPerPage], min);
+    ASSERT_EQ(values[(i + 1) * kRowsPerPage - 1], max);
+  }
+
+  // Skip records across pages, then read the following ones
+  auto record_reader =
+      internal::RecordReader::Make(file_reader->metadata()->schema()->Column(0));
+  record_reader->SetPageReader(rg_reader->GetColumnPageReader(0));
+  ASSERT_EQ(450, record_reader->SkipRecords(450));
+  ASSERT_EQ(10, record_reader->ReadRecords(10));
+  const auto* read_values = reinterpret_cast<const int64_t*>(record_reader->values());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(values[450 + i], read_values[i]);
+  }
+  ASSERT_EQ(kValueCount - 460, record_reader->SkipRecords(kValueCount));
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -23,11 +23,13 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -83,7 +85,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     std::vector<BloomFilter*> bloom_filters = {},
+                     std::vector<PageIndexBuilder*> page_index_builders = {})
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +97,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        bloom_filters_(std::move(bloom_filters)),
+        page_index_builders_(std::move(page_index_builders)) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -139,7 +145,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
         properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                                            bloom_filter(next_column_index_ - 1),
+                                            page_index_builder(next_column_index_ - 1));
     return column_writers_[0].get();
   }
 
@@ -208,6 +216,21 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  // The bloom filters of the columns, owned by the file writer. Null or
+  // missing for the columns without one.
+  std::vector<BloomFilter*> bloom_filters_;
+
+  BloomFilter* bloom_filter(int i) const {
+    return i < static_cast<int>(bloom_filters_.size()) ? bloom_filters_[i] : nullptr;
+  }
+
+  // Likewise for the builders of the page indexes of the columns
+  std::vector<PageIndexBuilder*> page_index_builders_;
+
+  PageIndexBuilder* page_index_builder(int i) const {
+    return i < static_cast<int>(page_index_builders_.size()) ? page_index_builders_[i]
+                                                             : nullptr;
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -246,8 +269,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
           buffered_row_group_, meta_encryptor, data_encryptor);
-      column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+      column_writers_.push_back(ColumnWriter::Make(col_meta, std::move(pager),
+                                                   properties_, bloom_filter(i),
+                                                   page_index_builder(i)));
     }
   }
 
@@ -284,6 +308,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      WriteBloomFilters();
+      WritePageIndexes();
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -314,7 +341,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
     auto rg_metadata = metadata_->AppendRowGroup();
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), AppendBloomFilters(),
+        AppendPageIndexBuilders()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -389,6 +417,110 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
+  // The bloom filters of the columns of each row group, written after the
+  // last row group
+  std::vector<std::vector<std::unique_ptr<BloomFilter>>> bloom_filters_;
+
+  // Make the bloom filters of the columns of a new row group. Boolean columns
+  // have none, nor have the columns of encrypted files as the filters would
+  // leak their values.
+  std::vector<BloomFilter*> AppendBloomFilters() {
+    std::vector<std::unique_ptr<BloomFilter>> row_group_filters(num_columns());
+    std::vector<BloomFilter*> out(num_columns(), nullptr);
+    if (properties_->file_encryption_properties() == nullptr) {
+      for (int i = 0; i < num_columns(); i++) {
+        const ColumnDescriptor* descr = schema_.Column(i);
+        if (descr->physical_type() == Type::BOOLEAN ||
+            !properties_->bloom_filter_enabled(descr->path())) {
+          continue;
+        }
+        const auto& options = properties_->bloom_filter_options(descr->path());
+        std::unique_ptr<BlockSplitBloomFilter> filter(new BlockSplitBloomFilter());
+        filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                         static_cast<uint32_t>(options.ndv), options.fpp) /
+                     8);
+        out[i] = filter.get();
+        row_group_filters[i] = std::move(filter);
+      }
+    }
+    bloom_filters_.push_back(std::move(row_group_filters));
+    return out;
+  }
+
+  void WriteBloomFilters() {
+    for (size_t row_group = 0; row_group < bloom_filters_.size(); row_group++) {
+      const auto& row_group_filters = bloom_filters_[row_group];
+      for (size_t column = 0; column < row_group_filters.size(); column++) {
+        if (row_group_filters[column] == nullptr) {
+          continue;
+        }
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+        row_group_filters[column]->WriteTo(sink_.get());
+        metadata_->SetBloomFilterOffset(static_cast<int>(row_group),
+                                        static_cast<int>(column), offset);
+      }
+    }
+    bloom_filters_.clear();
+  }
+
+  // The page index builders of the columns of each row group, whose indexes
+  // are written after the last row group
+  std::vector<std::vector<std::unique_ptr<PageIndexBuilder>>> page_index_builders_;
+
+  // Make the page index builders of the columns of a new row group. As with
+  // bloom filters, encrypted files have none. Nor have repeated columns, whose
+  // pages the column writer doesn't cut at row boundaries.
+  std::vector<PageIndexBuilder*> AppendPageIndexBuilders() {
+    std::vector<std::unique_ptr<PageIndexBuilder>> row_group_builders(num_columns());
+    std::vector<PageIndexBuilder*> out(num_columns(), nullptr);
+    if (properties_->file_encryption_properties() == nullptr) {
+      for (int i = 0; i < num_columns(); i++) {
+        const ColumnDescriptor* descr = schema_.Column(i);
+        if (descr->max_repetition_level() > 0 ||
+            !properties_->page_index_enabled(descr->path())) {
+          continue;
+        }
+        row_group_builders[i].reset(new PageIndexBuilder(descr));
+        out[i] = row_group_builders[i].get();
+      }
+    }
+    page_index_builders_.push_back(std::move(row_group_builders));
+    return out;
+  }
+
+  // Write the column indexes of all the column chunks, then their offset
+  // indexes, so that readers can fetch either kind at once
+  void WritePageIndexes() {
+    for (size_t row_group = 0; row_group < page_index_builders_.size(); row_group++) {
+      const auto& row_group_builders = page_index_builders_[row_group];
+      for (size_t column = 0; column < row_group_builders.size(); column++) {
+        if (row_group_builders[column] == nullptr ||
+            row_group_builders[column]->column_index() == nullptr) {
+          continue;
+        }
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+        int64_t length = row_group_builders[column]->column_index()->WriteTo(sink_.get());
+        metadata_->SetColumnIndexLocation(static_cast<int>(row_group),
+                                          static_cast<int>(column), offset,
+                                          static_cast<int32_t>(length));
+      }
+    }
+    for (size_t row_group = 0; row_group < page_index_builders_.size(); row_group++) {
+      const auto& row_group_builders = page_index_builders_[row_group];
+      for (size_t column = 0; column < row_group_builders.size(); column++) {
+        if (row_group_builders[column] == nullptr) {
+          continue;
+        }
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+        int64_t length = row_group_builders[column]->offset_index().WriteTo(sink_.get());
+        metadata_->SetOffsetIndexLocation(static_cast<int>(row_group),
+                                          static_cast<int>(column), offset,
+                                          static_cast<int32_t>(length));
+      }
+    }
+    page_index_builders_.clear();
+  }
+
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
     if (file_encryption_properties == nullptr) {
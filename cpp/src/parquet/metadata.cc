@@ -280,6 +280,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -363,6 +383,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -1312,6 +1358,30 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset) {
+    DCHECK_LT(row_group, static_cast<int>(row_groups_.size()));
+    auto& column_chunk = row_groups_[row_group].columns[column];
+    if (column_chunk.__isset.meta_data) {
+      column_chunk.meta_data.__set_bloom_filter_offset(offset);
+    }
+  }
+
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    DCHECK_LT(row_group, static_cast<int>(row_groups_.size()));
+    auto& column_chunk = row_groups_[row_group].columns[column];
+    column_chunk.__set_column_index_offset(offset);
+    column_chunk.__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length) {
+    DCHECK_LT(row_group, static_cast<int>(row_groups_.size()));
+    auto& column_chunk = row_groups_[row_group].columns[column];
+    column_chunk.__set_offset_index_offset(offset);
+    column_chunk.__set_offset_index_length(length);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1439,6 +1509,21 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetBloomFilterOffset(int row_group, int column,
+                                               int64_t offset) {
+  impl_->SetBloomFilterOffset(row_group, column, offset);
+}
+
+void FileMetaDataBuilder::SetColumnIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(row_group, column, offset, length);
+}
+
+void FileMetaDataBuilder::SetOffsetIndexLocation(int row_group, int column,
+                                                 int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(row_group, column, offset, length);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
@@ -164,6 +164,14 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t data_page_offset() const;
   bool has_index_page() const;
   int64_t index_page_offset() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
@@ -388,6 +396,17 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the bloom filter of a column chunk of a finished row group
+  // was written
+  void SetBloomFilterOffset(int row_group, int column, int64_t offset);
+
+  // Record where the page index of a column chunk of a finished row group was
+  // written
+  void SetColumnIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+  void SetOffsetIndexLocation(int row_group, int column, int64_t offset,
+                              int32_t length);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
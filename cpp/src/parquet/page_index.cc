@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// Thrift serialization
+
+OffsetIndex OffsetIndex::Deserialize(const uint8_t* data, uint32_t* len) {
+  format::OffsetIndex thrift_index;
+  DeserializeThriftMsg(data, len, &thrift_index);
+
+  OffsetIndex index;
+  index.page_locations.reserve(thrift_index.page_locations.size());
+  for (const auto& location : thrift_index.page_locations) {
+    index.page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return index;
+}
+
+int64_t OffsetIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::OffsetIndex thrift_index;
+  thrift_index.page_locations.reserve(page_locations.size());
+  for (const auto& location : page_locations) {
+    format::PageLocation thrift_location;
+    thrift_location.__set_offset(location.offset);
+    thrift_location.__set_compressed_page_size(location.compressed_page_size);
+    thrift_location.__set_first_row_index(location.first_row_index);
+    thrift_index.page_locations.push_back(std::move(thrift_location));
+  }
+  ThriftSerializer serializer;
+  return serializer.Serialize(&thrift_index, sink);
+}
+
+ColumnIndex ColumnIndex::Deserialize(const uint8_t* data, uint32_t* len) {
+  format::ColumnIndex thrift_index;
+  DeserializeThriftMsg(data, len, &thrift_index);
+
+  const size_t num_pages = thrift_index.null_pages.size();
+  if (thrift_index.min_values.size() != num_pages ||
+      thrift_index.max_values.size() != num_pages ||
+      (thrift_index.__isset.null_counts &&
+       thrift_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Malformed column index: list sizes don't match");
+  }
+
+  ColumnIndex index;
+  index.null_pages = std::move(thrift_index.null_pages);
+  index.min_values = std::move(thrift_index.min_values);
+  index.max_values = std::move(thrift_index.max_values);
+  // Unknown orders are safe to ignore
+  const auto boundary_order = static_cast<int>(thrift_index.boundary_order);
+  if (boundary_order == BoundaryOrder::ASCENDING ||
+      boundary_order == BoundaryOrder::DESCENDING) {
+    index.boundary_order = static_cast<BoundaryOrder::type>(boundary_order);
+  }
+  if (thrift_index.__isset.null_counts) {
+    index.null_counts = std::move(thrift_index.null_counts);
+  }
+  return index;
+}
+
+int64_t ColumnIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::ColumnIndex thrift_index;
+  thrift_index.__set_null_pages(null_pages);
+  thrift_index.__set_min_values(min_values);
+  thrift_index.__set_max_values(max_values);
+  thrift_index.__set_boundary_order(
+      static_cast<format::BoundaryOrder::type>(boundary_order));
+  if (!null_counts.empty()) {
+    thrift_index.__set_null_counts(null_counts);
+  }
+  ThriftSerializer serializer;
+  return serializer.Serialize(&thrift_index, sink);
+}
+
+// ----------------------------------------------------------------------
+// Row ranges
+
+RowRanges IntersectRowRanges(const RowRanges& left, const RowRanges& right) {
+  RowRanges result;
+  auto l = left.begin();
+  auto r = right.begin();
+  while (l != left.end() && r != right.end()) {
+    const int64_t start = std::max(l->start, r->start);
+    const int64_t end = std::min(l->end, r->end);
+    if (start < end) {
+      result.push_back({start, end});
+    }
+    // Advance the range that ends first, as it can't overlap any other
+    if (l->end < r->end) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return result;
+}
+
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<bool>& selected_pages, int64_t num_rows) {
+  const auto& locations = offset_index.page_locations;
+  DCHECK_EQ(locations.size(), selected_pages.size());
+
+  RowRanges result;
+  for (size_t i = 0; i < locations.size(); ++i) {
+    if (!selected_pages[i]) {
+      continue;
+    }
+    const int64_t start = locations[i].first_row_index;
+    const int64_t end =
+        i + 1 < locations.size() ? locations[i + 1].first_row_index : num_rows;
+    if (start >= end) {
+      continue;
+    }
+    // Merge the rows of consecutive pages
+    if (!result.empty() && result.back().end == start) {
+      result.back().end = end;
+    } else {
+      result.push_back({start, end});
+    }
+  }
+  return result;
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+namespace {
+
+template <typename DType>
+BoundaryOrder::type ComputeBoundaryOrder(const ColumnDescriptor* descr,
+                                         const ColumnIndex& index) {
+  auto comparator =
+      std::static_pointer_cast<TypedComparator<DType>>(Comparator::Make(descr));
+  bool ascending = true;
+  bool descending = true;
+  std::shared_ptr<TypedStatistics<DType>> previous;
+  for (size_t i = 0; i < index.null_pages.size(); ++i) {
+    if (index.null_pages[i]) {
+      continue;
+    }
+    // Decode the bounds through Statistics, which owns them
+    auto current = std::static_pointer_cast<TypedStatistics<DType>>(
+        Statistics::Make(descr, index.min_values[i], index.max_values[i],
+                         /*num_values=*/0, /*null_count=*/0, /*distinct_count=*/0,
+                         /*has_min_max=*/true));
+    if (previous != nullptr) {
+      ascending = ascending && !comparator->Compare(current->min(), previous->min()) &&
+                  !comparator->Compare(current->max(), previous->max());
+      descending = descending &&
+                   !comparator->Compare(previous->min(), current->min()) &&
+                   !comparator->Compare(previous->max(), current->max());
+    }
+    previous = std::move(current);
+  }
+  if (ascending) {
+    return BoundaryOrder::ASCENDING;
+  }
+  return descending ? BoundaryOrder::DESCENDING : BoundaryOrder::UNORDERED;
+}
+
+BoundaryOrder::type ComputeBoundaryOrder(const ColumnDescriptor* descr,
+                                         const ColumnIndex& index) {
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return ComputeBoundaryOrder<BooleanType>(descr, index);
+    case Type::INT32:
+      return ComputeBoundaryOrder<Int32Type>(descr, index);
+    case Type::INT64:
+      return ComputeBoundaryOrder<Int64Type>(descr, index);
+    case Type::INT96:
+      return ComputeBoundaryOrder<Int96Type>(descr, index);
+    case Type::FLOAT:
+      return ComputeBoundaryOrder<FloatType>(descr, index);
+    case Type::DOUBLE:
+      return ComputeBoundaryOrder<DoubleType>(descr, index);
+    case Type::BYTE_ARRAY:
+      return ComputeBoundaryOrder<ByteArrayType>(descr, index);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return ComputeBoundaryOrder<FLBAType>(descr, index);
+    default:
+      return BoundaryOrder::UNORDERED;
+  }
+}
+
+}  // namespace
+
+PageIndexBuilder::PageIndexBuilder(const ColumnDescriptor* descr)
+    : descr_(descr), has_column_index_(true), has_null_counts_(true),
+      num_located_pages_(0) {}
+
+void PageIndexBuilder::AddPage(const EncodedStatistics& stats, int64_t num_values,
+                               int64_t first_row_index) {
+  offset_index_.page_locations.push_back({0, 0, first_row_index});
+
+  const bool null_page = stats.has_null_count && stats.null_count == num_values;
+  if (!null_page && !(stats.has_min && stats.has_max)) {
+    // Without bounds for every page, the column index would be useless
+    has_column_index_ = false;
+  }
+  column_index_.null_pages.push_back(null_page);
+  column_index_.min_values.push_back(null_page ? "" : stats.min());
+  column_index_.max_values.push_back(null_page ? "" : stats.max());
+  has_null_counts_ = has_null_counts_ && stats.has_null_count;
+  column_index_.null_counts.push_back(stats.null_count);
+}
+
+void PageIndexBuilder::AddPageLocation(int64_t offset, int32_t compressed_page_size) {
+  DCHECK_LT(num_located_pages_, offset_index_.page_locations.size());
+  auto& location = offset_index_.page_locations[num_located_pages_++];
+  location.offset = offset;
+  location.compressed_page_size = compressed_page_size;
+}
+
+void PageIndexBuilder::Finish(int64_t column_chunk_offset) {
+  DCHECK_EQ(num_located_pages_, offset_index_.page_locations.size());
+  for (auto& location : offset_index_.page_locations) {
+    location.offset += column_chunk_offset;
+  }
+  if (!has_null_counts_) {
+    column_index_.null_counts.clear();
+  }
+  if (has_column_index_) {
+    column_index_.boundary_order = ComputeBoundaryOrder(descr_, column_index_);
+  }
+}
+
+}  // namespace parquet
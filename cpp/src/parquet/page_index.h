@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class EncodedStatistics;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Where a data page of a column chunk is in the file
+struct PARQUET_EXPORT PageLocation {
+  /// The offset of the page header in the file
+  int64_t offset;
+  /// The size of the page, including its header
+  int32_t compressed_page_size;
+  /// The index of the first row of the page in its row group
+  int64_t first_row_index;
+};
+
+/// \brief The locations of the data pages of a column chunk, in file order
+struct PARQUET_EXPORT OffsetIndex {
+  std::vector<PageLocation> page_locations;
+
+  /// \brief Deserialize an OffsetIndex from its Thrift encoding. Throws
+  /// ParquetException if the data is malformed.
+  /// \param[in] data the serialized OffsetIndex
+  /// \param[in,out] len the number of bytes available, set to the number read
+  static OffsetIndex Deserialize(const uint8_t* data, uint32_t* len);
+
+  /// \brief Serialize the OffsetIndex, returning the number of bytes written
+  int64_t WriteTo(ArrowOutputStream* sink) const;
+};
+
+/// \brief The statistics of the data pages of a column chunk, the i-th entry
+/// of each list describing the i-th page of its OffsetIndex
+struct PARQUET_EXPORT ColumnIndex {
+  /// Whether each page holds only nulls, in which case its min and max are empty
+  std::vector<bool> null_pages;
+  /// The plain-encoded lower and upper bounds of the values of each page
+  std::vector<std::string> min_values;
+  std::vector<std::string> max_values;
+  /// Whether the bounds are sorted by page, and in which direction
+  BoundaryOrder::type boundary_order = BoundaryOrder::UNORDERED;
+  /// The number of nulls in each page, or empty if unknown
+  std::vector<int64_t> null_counts;
+
+  /// \brief Deserialize a ColumnIndex from its Thrift encoding. Throws
+  /// ParquetException if the data is malformed.
+  /// \param[in] data the serialized ColumnIndex
+  /// \param[in,out] len the number of bytes available, set to the number read
+  static ColumnIndex Deserialize(const uint8_t* data, uint32_t* len);
+
+  /// \brief Serialize the ColumnIndex, returning the number of bytes written
+  int64_t WriteTo(ArrowOutputStream* sink) const;
+};
+
+/// \brief The rows [start, end) of a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t start;
+  int64_t end;
+};
+
+/// \brief Sorted, disjoint and non-empty ranges of the rows of a row group
+using RowRanges = std::vector<RowRange>;
+
+/// \brief The rows in both left and right
+PARQUET_EXPORT
+RowRanges IntersectRowRanges(const RowRanges& left, const RowRanges& right);
+
+/// \brief The rows of the selected pages of a column chunk
+/// \param[in] offset_index the OffsetIndex of the column chunk
+/// \param[in] selected_pages whether each page of offset_index is selected
+/// \param[in] num_rows the number of rows of the row group
+PARQUET_EXPORT
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<bool>& selected_pages, int64_t num_rows);
+
+/// \brief Collects the page index of a column chunk while it is written
+///
+/// Pages are added as the column writer cuts them, while their locations are
+/// only known once they are written out (later, if they are buffered for
+/// dictionary encoding), in the same order.
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  explicit PageIndexBuilder(const ColumnDescriptor* descr);
+
+  /// \brief Add the next data page
+  /// \param[in] stats the plain-encoded statistics of the page
+  /// \param[in] num_values the number of values of the page, including nulls
+  /// \param[in] first_row_index the index of the first row of the page
+  void AddPage(const EncodedStatistics& stats, int64_t num_values,
+               int64_t first_row_index);
+
+  /// \brief Record where the next added page was written, relative to the
+  /// start of its column chunk
+  void AddPageLocation(int64_t offset, int32_t compressed_page_size);
+
+  /// \brief Make the page locations absolute and compute the boundary order,
+  /// once all the pages of the column chunk are written
+  void Finish(int64_t column_chunk_offset);
+
+  /// \brief The column index, or null if some page has no min and max
+  const ColumnIndex* column_index() const {
+    return has_column_index_ ? &column_index_ : NULLPTR;
+  }
+
+  const OffsetIndex& offset_index() const { return offset_index_; }
+
+ private:
+  const ColumnDescriptor* descr_;
+  ColumnIndex column_index_;
+  OffsetIndex offset_index_;
+  bool has_column_index_;
+  bool has_null_counts_;
+  size_t num_located_pages_;
+};
+
+}  // namespace parquet
@@ -93,6 +93,18 @@ static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+
+/// \brief The sizing of the bloom filter of a column chunk: the filter is
+/// sized so that, with up to ndv distinct values in the chunk, a value that
+/// isn't in it is found with a probability of at most fpp.
+struct PARQUET_EXPORT BloomFilterOptions {
+  int32_t ndv = DEFAULT_BLOOM_FILTER_NDV;
+  double fpp = DEFAULT_BLOOM_FILTER_FPP;
+};
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -106,7 +118,9 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -128,6 +142,18 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -140,6 +166,14 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const {
+    return bloom_filter_options_;
+  }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -147,6 +181,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  BloomFilterOptions bloom_filter_options_;
+  bool page_index_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -372,6 +409,74 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a bloom filter for each chunk of the columns (except boolean ones),
+    /// after the row groups, unless the file is encrypted. Readers may test
+    /// the filter to skip row groups that cannot contain a value.
+    Builder* enable_bloom_filter(const BloomFilterOptions& options = {}) {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      default_column_properties_.set_bloom_filter_options(options);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    /// Write a bloom filter for each chunk of the column at the path.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Write the page index (a ColumnIndex and an OffsetIndex) of each chunk
+    /// of the non-repeated columns, after the row groups, unless the file is
+    /// encrypted. Readers may use it to skip the pages that cannot hold rows
+    /// of interest.
+    Builder* enable_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_page_index(path->ToDotString());
+    }
+
+    Builder* disable_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_page_index(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -390,6 +495,12 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
@@ -415,6 +526,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -478,6 +592,19 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -534,13 +661,26 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+static constexpr bool kArrowDefaultPreBuffer = false;
+
+// Default number of batches a threaded RecordBatchReader decodes ahead
+static constexpr int32_t kArrowDefaultBatchReadahead = 1;
+
+// Default limits for coalescing the reads of pre-buffered column chunks
+static constexpr int64_t kArrowDefaultPreBufferHoleSizeLimit = 8192;
+static constexpr int64_t kArrowDefaultPreBufferRangeSizeLimit = 32 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(kArrowDefaultPreBuffer),
+        pre_buffer_hole_size_limit_(kArrowDefaultPreBufferHoleSizeLimit),
+        pre_buffer_range_size_limit_(kArrowDefaultPreBufferRangeSizeLimit),
+        batch_readahead_(kArrowDefaultBatchReadahead) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -565,10 +705,43 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// Enable read coalescing: before reading row groups, read all the selected
+  /// column chunks of all the selected row groups at once, in the background,
+  /// merging the reads of column chunks close to each other. This hides the
+  /// latency of file systems with expensive reads, such as S3.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// Set how reads of pre-buffered column chunks are coalesced: reads less than
+  /// hole_size_limit bytes apart are merged, unless that makes a read larger
+  /// than range_size_limit bytes.
+  void set_pre_buffer_limits(int64_t hole_size_limit, int64_t range_size_limit) {
+    pre_buffer_hole_size_limit_ = hole_size_limit;
+    pre_buffer_range_size_limit_ = range_size_limit;
+  }
+
+  int64_t pre_buffer_hole_size_limit() const { return pre_buffer_hole_size_limit_; }
+
+  int64_t pre_buffer_range_size_limit() const { return pre_buffer_range_size_limit_; }
+
+  /// Set how many batches a RecordBatchReader decodes ahead of the batch it
+  /// returns, when use_threads is set and the columns are decoded in parallel.
+  /// Decoded batches are held in memory until they are returned.
+  void set_batch_readahead(int32_t batch_readahead) {
+    batch_readahead_ = batch_readahead;
+  }
+
+  int32_t batch_readahead() const { return batch_readahead_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  int64_t pre_buffer_hole_size_limit_;
+  int64_t pre_buffer_range_size_limit_;
+  int32_t batch_readahead_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties